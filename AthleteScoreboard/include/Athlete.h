@@ -2,31 +2,35 @@
 #ifndef ATHLETE_H
 #define ATHLETE_H
 
-#include <cmath>
-#include <compare>
 #include <cstdint>
 #include <string>
 
 #include <SDL2/SDL.h>
 
-struct [[nodiscard]] Athlete final
+#include "Utility.h"
+
+using AthleteID = std::uint32_t;
+
+struct [[nodiscard]] AthleteLayout final
+{
+    std::uint32_t displayedScore = 0u;
+
+    SDL_Rect nameArea{ };
+    SDL_Rect scoreBarArea{ };
+    SDL_Rect scoreTextArea{ };
+    SDL_Rect tagArea{ };
+};
+
+struct [[nodiscard]] AthleteDetails final
 {
     std::string name;
+    TextHandle nameText;
     SDL_Colour colour;
 
     std::int32_t pointsToAdd;
     bool isEliminated;
+    bool isNewlyEliminated;
     bool isWinner;
-
-    std::uint32_t originalScore;
-    std::float_t currentScore;
-    std::uint32_t newScore;
-
-    std::int32_t originalPosition;
-    std::float_t currentPosition;
-    std::int32_t newPosition;
 };
 
-[[nodiscard]] extern auto operator <=>(const Athlete& lhs, const Athlete& rhs) noexcept -> std::partial_ordering;
-
 #endif
@@ -2,21 +2,28 @@
 #ifndef ATHLETE_SCOREBOARD_H
 #define ATHLETE_SCOREBOARD_H
 
+#include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
-#include <functional>
+#include <optional>
+#include <string>
 #include <string_view>
-#include <unordered_map>
-#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 
 #include "Athlete.h"
+#include "AthleteTable.h"
+#include "EasingCurve.h"
+#include "FontRegistry.h"
+#include "InterpolationKernel.h"
 #include "Renderer.h"
 #include "ScriptEngine.h"
 #include "TextCache.h"
+#include "Utility.h"
 #include "Window.h"
 
 class [[nodiscard]] AthleteScoreboard final
@@ -65,21 +72,38 @@ private:
         SDL_Colour winnerText{ 0x00u, 0x00u, 0x00u, SDL_ALPHA_OPAQUE };
     };
 
+    struct [[nodiscard]] Viewport final
+    {
+        bool isEnabled = false;
+        std::uint32_t visibleRowCount = 0u;
+
+        std::float_t scrollOffset = 0.0f;
+        std::string followedAthleteName{ };
+        std::optional<AthleteID> followedAthleteID = std::nullopt;
+    };
+
     State m_state = State::Idle;
     bool m_readyToChangeState = true;
 
     Dimensions m_dimensions{ };
     std::float_t m_windowHeight = 0.0f;
+    std::float_t m_contentHeight = 0.0f;
+
+    Viewport m_viewport{ };
 
     Eliminations m_eliminations{ };
     Colours m_colours{ };
 
-    std::vector<Athlete> m_athletes{ };
+    AthleteTable m_athletes{ };
     std::uint32_t m_maximumScore = 0u;
     std::int32_t m_maximumScoreTextWidth = 0;
     std::float_t m_pixelsPerPoint = 0.0f;
 
-    std::function<auto(std::float_t) -> std::float_t> m_easingFunction;
+    EasingCurve m_orderingEasingCurve{ };
+    EasingCurve m_scoreEasingCurve{ };
+    InterpolationKernel m_interpolationKernel{ };
+
+    FontRegistry m_fontRegistry{ };
 
     TextCache m_athleteTextCache;
     TTF_Font* m_athleteFont = nullptr;
@@ -87,12 +111,21 @@ private:
     TextCache m_eliminatedTextCache;
     TTF_Font* m_eliminatedFont = nullptr;
 
-    std::unordered_map<std::uint32_t, SDL_Texture*> m_ordinalNumberTexts{ };
-    SDL_Texture* m_eliminatedText = nullptr;
-    SDL_Texture* m_winnerText = nullptr;
-    std::unordered_set<std::string> m_newlyEliminatedAthleteNames{ };
+    TextHandle m_eliminatedText = 0u;
+    TextHandle m_winnerText = 0u;
+
+    std::vector<SDL_Rect> m_ordinalNumberAreas{ };
+
+    std::vector<AthleteID> m_rowsByDisplayedPosition{ };
+    std::vector<bool> m_isRowOverlapping{ };
 
     std::float_t m_interpolation = 0.0f;
+    std::float_t m_previousInterpolation = 0.0f;
+
+    std::float_t m_accumulatedTime = 0.0f;
+    std::float_t m_stepInterpolation = 0.0f;
+    bool m_isStepAnimating = false;
+    bool m_needsRender = true;
 
     bool m_didInitialiseSuccessfully = false;
 
@@ -100,11 +133,20 @@ public:
     explicit AthleteScoreboard(const ScriptEngine& scriptEngine);
     ~AthleteScoreboard() noexcept;
 
-    auto LoadTextCaches(const ScriptEngine& scriptEngine, const Renderer& renderer) -> void;
+    auto LoadTextCaches(const ScriptEngine& scriptEngine, const Renderer& renderer, const bool isRasterisationSynchronous) -> void;
+    auto ReleaseTextCaches() -> void;
 
     auto Update(const std::float_t deltaTime) -> void;
     auto Render(const Renderer& renderer) -> void;
     auto HandleKeyPress(const SDL_Scancode scancode) -> void;
+    auto AdvanceState() -> void;
+
+    inline auto MarkDirty() noexcept -> void { m_needsRender = true; }
+    [[nodiscard]] inline auto NeedsRender() const noexcept -> bool { return m_needsRender; }
+    [[nodiscard]] auto GetTimeUntilNextUpdate() const -> std::optional<std::chrono::milliseconds>;
+
+    [[nodiscard]] inline auto CanAdvanceState() const noexcept -> bool { return m_readyToChangeState && m_state != State::DisplayEliminatedText && m_state != State::End; }
+    [[nodiscard]] inline auto HasFinished() const noexcept -> bool { return m_state == State::End && !m_isStepAnimating; }
 
     [[nodiscard]] inline auto DidInitialiseSuccessfully() const noexcept -> bool { return m_didInitialiseSuccessfully; }
 
@@ -112,23 +154,43 @@ public:
     [[nodiscard]] inline auto GetWindowHeight() const noexcept -> std::float_t { return m_windowHeight; }
 
 private:
+    auto Step(const std::float_t timeStep) -> void;
+    [[nodiscard]] inline auto GetDisplayedInterpolation() const noexcept -> std::float_t { return std::lerp(m_previousInterpolation, m_interpolation, m_stepInterpolation); }
+
+    auto LogTextCacheStatistics() const -> void;
+
     auto LoadAthletes(const ScriptEngine& scriptEngine) -> void;
     auto LoadDimensions(const ScriptEngine& scriptEngine) -> void;
     auto LoadEliminations(const ScriptEngine& scriptEngine) -> void;
     auto LoadColours(const ScriptEngine& scriptEngine) -> void;
+    auto LoadViewport(const ScriptEngine& scriptEngine) -> void;
+    [[nodiscard]] auto LoadEasingCurve(const ScriptEngine& scriptEngine, const std::string_view easingName, const std::string_view defaultCurveName) const -> EasingCurve;
 
     auto CalculateAthletePositions() -> void;
     auto CalculateNewAthleteScoresAndPositions() -> void;
 
     auto CalculateMaximumScoreTextWidth() -> void;
     auto CalculatePixelsPerPoint() -> void;
-    auto LoadOrdinalNumberTexts() -> void;
+    auto PrewarmTextCaches() -> void;
+
+    auto FindFollowedAthlete() -> void;
+    auto ScrollBy(const std::float_t distance) -> void;
+    auto UpdateScrollOffset() -> void;
+    auto FindOverlappingRows() -> void;
+    [[nodiscard]] auto IsRowVisible(const std::float_t position) const noexcept -> bool;
+    [[nodiscard]] auto GetVisibleRowRange() const noexcept -> std::pair<std::size_t, std::size_t>;
+    [[nodiscard]] inline auto GetRowPitch() const noexcept -> std::float_t { return static_cast<std::float_t>(m_dimensions.barHeight + m_dimensions.distanceBetweenBars); }
+    [[nodiscard]] inline auto GetDisplayedPosition(const AthleteID athleteID) const noexcept -> std::float_t { return std::lerp(m_athletes.previousPositions[athleteID], m_athletes.currentPositions[athleteID], m_stepInterpolation); }
+
+    auto CalculateLayout() -> void;
+    auto UpdateVisibleAthleteLayouts() -> void;
+    auto UpdateAthleteLayout(const AthleteID athleteID) -> void;
 
     auto RenderSidebar(const Renderer& renderer) const -> void;
-    auto RenderOrdinalNumbers(const Renderer& renderer) -> void;
-    auto RenderAthleteScoreBar(const Renderer& renderer, const Athlete& athlete) -> void;
-    auto RenderAthleteName(const Renderer& renderer, const Athlete& athlete) -> void;
-    auto RenderAthleteScoreBarText(const Renderer& renderer, const Athlete& athlete) -> void;
+    auto RenderOrdinalNumbers() -> void;
+    auto RenderAthleteScoreBar(const Renderer& renderer, const AthleteID athleteID) const -> void;
+    auto RenderAthleteName(const AthleteID athleteID) -> void;
+    auto RenderAthleteScoreBarText(const AthleteID athleteID) -> void;
 };
 
 #endif
@@ -0,0 +1,55 @@
+#pragma once
+#ifndef ATHLETE_TABLE_H
+#define ATHLETE_TABLE_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Athlete.h"
+
+struct [[nodiscard]] AthleteTable final
+{
+    std::vector<std::uint32_t> originalScores{ };
+    std::vector<std::float_t> previousScores{ };
+    std::vector<std::float_t> currentScores{ };
+    std::vector<std::uint32_t> newScores{ };
+
+    std::vector<std::int32_t> originalPositions{ };
+    std::vector<std::float_t> previousPositions{ };
+    std::vector<std::float_t> currentPositions{ };
+    std::vector<std::int32_t> newPositions{ };
+
+    std::vector<AthleteDetails> details{ };
+    std::vector<AthleteLayout> layouts{ };
+
+    // Alphabetical rank of each name, used to break ties.
+    std::vector<std::uint32_t> nameRanks{ };
+
+    // Athlete IDs ordered from first to last place.
+    std::vector<AthleteID> standings{ };
+
+    auto Add(AthleteDetails&& athleteDetails, const std::uint32_t originalScore) -> AthleteID;
+    auto RankNames() -> void;
+
+    template <typename T>
+    [[nodiscard]] inline auto IsRankedAbove(const AthleteID lhs, const AthleteID rhs, const std::vector<T>& scores) const noexcept -> bool
+    {
+        if (scores[lhs] != scores[rhs])
+        {
+            return scores[lhs] > scores[rhs];
+        }
+
+        if (originalScores[lhs] != originalScores[rhs])
+        {
+            return originalScores[lhs] > originalScores[rhs];
+        }
+
+        return nameRanks[lhs] > nameRanks[rhs];
+    }
+
+    [[nodiscard]] inline auto GetCount() const noexcept -> std::size_t { return details.size(); }
+};
+
+#endif
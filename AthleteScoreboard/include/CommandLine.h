@@ -0,0 +1,25 @@
+#pragma once
+#ifndef COMMAND_LINE_H
+#define COMMAND_LINE_H
+
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "FrameExporter.h"
+
+struct [[nodiscard]] CommandLineOptions final
+{
+    bool isHeadless = false;
+    bool isBenchmark = false;
+
+    std::optional<FrameExporter::Format> exportFormat = std::nullopt;
+    std::string exportPath{ };
+    std::uint32_t exportFrameRate = 60u;
+    std::float_t exportStageHoldSeconds = 1.0f;
+};
+
+[[nodiscard]] extern auto ParseCommandLine(const std::int32_t argc, char** const argv) -> CommandLineOptions;
+
+#endif
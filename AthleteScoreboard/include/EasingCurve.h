@@ -0,0 +1,33 @@
+#pragma once
+#ifndef EASING_CURVE_H
+#define EASING_CURVE_H
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+class [[nodiscard]] EasingCurve final
+{
+public:
+    using Function = std::function<auto(std::float_t) -> std::float_t>;
+    using NativeFunction = auto(*)(const std::float_t) noexcept -> std::float_t;
+
+    static constexpr std::size_t SampleCount = 4'096u;
+
+private:
+    NativeFunction m_nativeFunction = nullptr;
+    std::vector<std::float_t> m_samples{ };
+
+public:
+    [[nodiscard]] static auto FindNativeFunction(const std::string_view name) noexcept -> NativeFunction;
+
+    EasingCurve() = default;
+    explicit EasingCurve(const NativeFunction nativeFunction);
+    explicit EasingCurve(const Function& function);
+
+    [[nodiscard]] auto Evaluate(const std::float_t x) const noexcept -> std::float_t;
+};
+
+#endif
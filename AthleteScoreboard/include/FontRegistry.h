@@ -0,0 +1,56 @@
+#pragma once
+#ifndef FONT_REGISTRY_H
+#define FONT_REGISTRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include "MappedFile.h"
+
+class [[nodiscard]] FontRegistry final
+{
+private:
+    struct [[nodiscard]] FontFile final
+    {
+        MappedFile file{ };
+        std::uint32_t referenceCount = 0u;
+    };
+
+    struct [[nodiscard]] OpenFont final
+    {
+        TTF_Font* font = nullptr;
+        std::string path{ };
+        std::int32_t pointSize = 0;
+
+        std::uint32_t referenceCount = 0u;
+        bool isShared = false;
+    };
+
+    std::unordered_map<std::string, FontFile> m_fontFiles{ };
+    std::vector<OpenFont> m_openFonts{ };
+
+public:
+    FontRegistry() = default;
+    ~FontRegistry() noexcept;
+
+    FontRegistry(const FontRegistry&) = delete;
+    auto operator =(const FontRegistry&) -> FontRegistry& = delete;
+
+    [[nodiscard]] auto Acquire(const std::string& path, const std::int32_t pointSize) -> TTF_Font*;
+    [[nodiscard]] auto AcquireUnique(const std::string& path, const std::int32_t pointSize) -> TTF_Font*;
+    auto Release(TTF_Font* const font) -> void;
+
+    [[nodiscard]] auto GetFileData(const std::string& path) const -> std::span<const std::byte>;
+
+private:
+    [[nodiscard]] auto OpenFontFromFile(const std::string& path, const std::int32_t pointSize, const bool isShared) -> TTF_Font*;
+};
+
+#endif
@@ -0,0 +1,70 @@
+#pragma once
+#ifndef FRAME_EXPORTER_H
+#define FRAME_EXPORTER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+class [[nodiscard]] FrameExporter final
+{
+public:
+    enum class [[nodiscard]] Format
+    {
+        RawRGBA,
+        PNG,
+        QOI,
+    };
+
+private:
+    struct [[nodiscard]] Frame final
+    {
+        std::uint64_t index = 0u;
+        std::vector<std::uint8_t> rgbaPixels{ };
+    };
+
+    Format m_format = Format::RawRGBA;
+    std::string m_outputPath{ };
+
+    std::uint32_t m_width = 0u;
+    std::uint32_t m_height = 0u;
+    std::uint64_t m_submittedFrameCount = 0u;
+
+    std::FILE* m_rawStream = nullptr;
+    bool m_ownsRawStream = false;
+
+    std::vector<std::jthread> m_workers{ };
+    std::size_t m_maximumQueuedFrameCount = 0u;
+
+    std::mutex m_frameMutex{ };
+    std::condition_variable_any m_frameAvailableCondition{ };
+    std::condition_variable m_frameSpaceCondition{ };
+    std::deque<Frame> m_frames{ };
+    std::size_t m_framesInProgress = 0u;
+    std::uint64_t m_failedFrameCount = 0u;
+
+public:
+    FrameExporter(const Format format, const std::string& outputPath, const std::uint32_t width, const std::uint32_t height, const std::uint32_t workerCount);
+    ~FrameExporter() noexcept;
+
+    FrameExporter(const FrameExporter&) = delete;
+    auto operator =(const FrameExporter&) -> FrameExporter& = delete;
+
+    auto Submit(std::vector<std::uint8_t> rgbaPixels) -> void;
+    auto Finish() -> void;
+
+    [[nodiscard]] inline auto GetSubmittedFrameCount() const noexcept -> std::uint64_t { return m_submittedFrameCount; }
+
+private:
+    auto RunWorker(const std::stop_token stopToken) -> void;
+    auto WriteImage(const Frame& frame) const -> bool;
+};
+
+#endif
@@ -0,0 +1,53 @@
+#pragma once
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <chrono>
+#include <cstdint>
+
+#include "Renderer.h"
+#include "ScriptEngine.h"
+
+class [[nodiscard]] FramePacer final
+{
+public:
+    enum class [[nodiscard]] Mode
+    {
+        VSync,
+        AdaptiveVSync,
+        FixedRate,
+    };
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::chrono::microseconds SpinDuration{ 2'000 };
+    static constexpr std::chrono::seconds ReportInterval{ 10 };
+
+    Mode m_mode = Mode::VSync;
+    std::uint32_t m_targetFrameRate = 60u;
+
+    Clock::duration m_framePeriod{ };
+    Clock::time_point m_frameStart{ };
+    Clock::time_point m_frameDeadline{ };
+
+    Clock::time_point m_reportStart{ };
+    std::uint64_t m_presentedFrameCount = 0u;
+    std::uint64_t m_missedDeadlineCount = 0u;
+
+public:
+    explicit FramePacer(const ScriptEngine& scriptEngine);
+    explicit FramePacer(const std::uint32_t targetFrameRate);
+
+    auto Initialise(const Renderer& renderer) -> void;
+    auto WaitForNextFrame(const bool didPresent) -> void;
+    auto Reset() -> void;
+
+    [[nodiscard]] inline auto GetMode() const noexcept -> Mode { return m_mode; }
+    [[nodiscard]] inline auto GetFramePeriod() const noexcept -> Clock::duration { return m_framePeriod; }
+
+private:
+    auto ReportMissedDeadlines(const Clock::time_point now) -> void;
+};
+
+#endif
@@ -0,0 +1,135 @@
+#pragma once
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include "Renderer.h"
+
+class [[nodiscard]] GlyphAtlas final
+{
+public:
+    enum class [[nodiscard]] Mode
+    {
+        Bitmap,
+        SignedDistanceField,
+    };
+
+    struct [[nodiscard]] Glyph final
+    {
+        std::uint32_t page = 0u;
+        SDL_Rect sourceArea{ };
+
+        std::int32_t offsetX = 0;
+        std::int32_t offsetY = 0;
+        std::int32_t advance = 0;
+
+        bool isLoaded = false;
+    };
+
+private:
+    struct [[nodiscard]] TextExtents final
+    {
+        std::int32_t left;
+        std::int32_t right;
+    };
+
+    struct [[nodiscard]] Page final
+    {
+        SDL_Texture* texture = nullptr;
+        std::vector<std::uint32_t> pixels{ };
+        std::vector<std::uint8_t> distances{ };
+
+        std::int32_t shelfX = 0;
+        std::int32_t shelfY = 0;
+        std::int32_t shelfHeight = 0;
+
+        bool isDirty = false;
+    };
+
+    struct [[nodiscard]] CacheHeader final
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t mode;
+        std::int32_t pageSize;
+        std::int32_t lineHeight;
+        std::int32_t ascent;
+        std::uint32_t pageCount;
+    };
+
+    struct [[nodiscard]] CachedPage final
+    {
+        std::int32_t shelfX;
+        std::int32_t shelfY;
+        std::int32_t shelfHeight;
+    };
+
+    static constexpr std::int32_t PageSize = 512;
+    static constexpr std::int32_t GlyphPadding = 1;
+
+    static constexpr std::uint32_t CacheMagic = 0x53414C47u;
+    static constexpr std::uint32_t CacheVersion = 1u;
+
+    TTF_Font* m_font = nullptr;
+    const Renderer* m_renderer = nullptr;
+    Mode m_mode = Mode::Bitmap;
+
+    std::int32_t m_lineHeight = 0;
+    std::int32_t m_ascent = 0;
+
+    std::uint32_t m_targetHeight = 0u;
+    std::array<std::uint8_t, 256u> m_distanceCoverage{ };
+
+    std::array<Glyph, 256u> m_glyphs{ };
+    std::array<std::array<std::int32_t, 10u>, 10u> m_digitKerning{ };
+    std::vector<Page> m_pages{ };
+
+    std::string m_cacheFilepath{ };
+    bool m_hasUncachedGlyphs = false;
+
+    std::uint64_t m_glyphHitCount = 0u;
+    std::uint64_t m_glyphMissCount = 0u;
+
+public:
+    GlyphAtlas() = default;
+    ~GlyphAtlas() noexcept;
+
+    auto Initialise(TTF_Font* const font, const Renderer& renderer, const Mode mode = Mode::Bitmap, const std::string& cacheFilepath = "") -> void;
+    auto Release() -> void;
+    auto SetTargetHeight(const std::uint32_t targetHeight) -> void;
+
+    [[nodiscard]] auto MeasureText(const std::string_view text) -> std::int32_t;
+    auto DrawText(const std::string_view text, const SDL_Rect& area, const SDL_Colour& colour) -> void;
+
+    [[nodiscard]] auto GetGlyph(const std::uint8_t character) -> const Glyph&;
+    [[nodiscard]] auto GetKerning(const std::uint8_t previousCharacter, const std::uint8_t character) const -> std::int32_t;
+    [[nodiscard]] auto GetPageTexture(const std::uint32_t page) -> SDL_Texture*;
+    auto UploadDirtyPages() -> void;
+    auto SaveCache() -> void;
+
+    [[nodiscard]] inline auto GetLineHeight() const noexcept -> std::int32_t { return m_lineHeight; }
+    [[nodiscard]] inline auto GetGlyphHitCount() const noexcept -> std::uint64_t { return m_glyphHitCount; }
+    [[nodiscard]] inline auto GetGlyphMissCount() const noexcept -> std::uint64_t { return m_glyphMissCount; }
+    [[nodiscard]] auto GetResidentByteCount() const noexcept -> std::size_t;
+
+private:
+    [[nodiscard]] auto CalculateTextExtents(const std::string_view text) -> TextExtents;
+    [[nodiscard]] auto RasteriseGlyph(const std::uint8_t character) -> Glyph;
+    auto ResolveDistances(Page& page, const SDL_Rect& area) const -> void;
+    [[nodiscard]] auto LoadCache() -> bool;
+    [[nodiscard]] auto CreatePage() -> bool;
+    [[nodiscard]] auto AllocateArea(const std::int32_t width, const std::int32_t height) -> std::optional<std::pair<std::uint32_t, SDL_Point>>;
+};
+
+#endif
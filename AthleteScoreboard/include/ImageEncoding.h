@@ -0,0 +1,12 @@
+#pragma once
+#ifndef IMAGE_ENCODING_H
+#define IMAGE_ENCODING_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+[[nodiscard]] extern auto EncodePNG(const std::span<const std::uint8_t> rgbaPixels, const std::uint32_t width, const std::uint32_t height) -> std::vector<std::uint8_t>;
+[[nodiscard]] extern auto EncodeQOI(const std::span<const std::uint8_t> rgbaPixels, const std::uint32_t width, const std::uint32_t height) -> std::vector<std::uint8_t>;
+
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef INTERPOLATION_KERNEL_H
+#define INTERPOLATION_KERNEL_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+class [[nodiscard]] InterpolationKernel final
+{
+public:
+    enum class [[nodiscard]] InstructionSet
+    {
+        Scalar,
+        SSE2,
+        AVX2,
+    };
+
+private:
+    using ScoreFunction = auto(*)(const std::uint32_t* const originalValues, const std::uint32_t* const newValues, std::float_t* const currentValues, const std::size_t count, const std::float_t interpolation) noexcept -> void;
+    using PositionFunction = auto(*)(const std::int32_t* const originalValues, const std::int32_t* const newValues, std::float_t* const currentValues, const std::size_t count, const std::float_t interpolation) noexcept -> void;
+
+    InstructionSet m_instructionSet = InstructionSet::Scalar;
+
+    ScoreFunction m_interpolateScores = nullptr;
+    PositionFunction m_interpolatePositions = nullptr;
+
+public:
+    [[nodiscard]] static auto IsSupported(const InstructionSet instructionSet) noexcept -> bool;
+    [[nodiscard]] static auto GetBestInstructionSet() noexcept -> InstructionSet;
+    [[nodiscard]] static auto GetInstructionSetName(const InstructionSet instructionSet) noexcept -> std::string_view;
+
+    explicit InterpolationKernel(const InstructionSet instructionSet = GetBestInstructionSet());
+
+    auto InterpolateScores(const std::span<const std::uint32_t> originalScores, const std::span<const std::uint32_t> newScores, const std::span<std::float_t> currentScores, const std::float_t interpolation) const noexcept -> void;
+    auto InterpolatePositions(const std::span<const std::int32_t> originalPositions, const std::span<const std::int32_t> newPositions, const std::span<std::float_t> currentPositions, const std::float_t interpolation) const noexcept -> void;
+
+    [[nodiscard]] inline auto GetInstructionSet() const noexcept -> InstructionSet { return m_instructionSet; }
+};
+
+extern auto RunInterpolationKernelBenchmark() -> void;
+
+#endif
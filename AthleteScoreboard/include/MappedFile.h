@@ -0,0 +1,39 @@
+#pragma once
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+class [[nodiscard]] MappedFile final
+{
+private:
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#else
+    int m_fileDescriptor = -1;
+#endif
+
+    const std::byte* m_data = nullptr;
+    std::size_t m_size = 0u;
+
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& filepath);
+    ~MappedFile() noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    auto operator =(const MappedFile&) -> MappedFile& = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    auto operator =(MappedFile&& other) noexcept -> MappedFile&;
+
+    auto Close() noexcept -> void;
+
+    [[nodiscard]] inline auto IsOpen() const noexcept -> bool { return m_data != nullptr; }
+    [[nodiscard]] inline auto GetData() const noexcept -> std::span<const std::byte> { return std::span<const std::byte>(m_data, m_size); }
+};
+
+#endif
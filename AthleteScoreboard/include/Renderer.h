@@ -2,7 +2,11 @@
 #ifndef RENDERER_H
 #define RENDERER_H
 
+#include <cmath>
+#include <cstdint>
 #include <optional>
+#include <unordered_map>
+#include <vector>
 
 #include <SDL2/SDL.h>
 
@@ -10,22 +14,72 @@
 
 class [[nodiscard]] Renderer final
 {
+public:
+    enum class [[nodiscard]] Layer
+        : std::uint8_t
+    {
+        Background,
+        Bars,
+        Text,
+    };
+
 private:
+    struct [[nodiscard]] DrawCommand final
+    {
+        std::uint32_t group;
+        Layer layer;
+        SDL_Texture* texture;
+        std::uint32_t firstVertex;
+    };
+
     SDL_Renderer* m_handle = nullptr;
+    SDL_Surface* m_surface = nullptr;
+    std::float_t m_pixelDensity = 1.0f;
+
+    mutable std::vector<SDL_Vertex> m_vertices{ };
+    mutable std::vector<SDL_Vertex> m_sortedVertices{ };
+    mutable std::vector<DrawCommand> m_commands{ };
+    mutable std::vector<std::int32_t> m_indices{ };
+
+    mutable std::optional<SDL_Colour> m_drawColour = std::nullopt;
+    mutable std::unordered_map<SDL_Texture*, SDL_Colour> m_textureModulations{ };
+
+    mutable std::uint32_t m_drawGroup = 0u;
+    mutable std::vector<SDL_Texture*> m_texturesPendingDestruction{ };
 
 public:
     explicit Renderer(const Window& window);
+    explicit Renderer(const Window::Size size);
     ~Renderer() noexcept;
 
     auto Clear(const SDL_Colour& colour) const -> void;
 
-    auto DrawRectangle(const SDL_Rect& rectangle, const SDL_Colour& colour) const -> void;
-    auto DrawTexture(SDL_Texture* const texture, const SDL_Rect& area, const std::optional<SDL_Colour>& colourMod = std::nullopt) const -> void;
+    auto DrawRectangle(const SDL_Rect& rectangle, const SDL_Colour& colour, const Layer layer) const -> void;
+    auto DrawTexture(SDL_Texture* const texture, const SDL_Rect& area, const Layer layer, const std::optional<SDL_Colour>& colourMod = std::nullopt) const -> void;
+    auto DrawTexture(SDL_Texture* const texture, const SDL_Rect& sourceArea, const SDL_Rect& area, const Layer layer, const std::optional<SDL_Colour>& colourMod = std::nullopt) const -> void;
+
+    auto DestroyTexture(SDL_Texture* const texture) const -> void;
 
+    inline auto SetDrawGroup(const std::uint32_t group) const noexcept -> void { m_drawGroup = group; }
+
+    auto Flush() const -> void;
     auto Present() const -> void;
 
+    [[nodiscard]] auto ReadPixels() const -> std::vector<std::uint8_t>;
+    [[nodiscard]] auto GetOutputSize() const -> Window::Size;
+
     [[nodiscard]] inline auto IsValid() const noexcept -> bool { return m_handle != nullptr; }
     [[nodiscard]] inline auto GetRawHandle() const noexcept -> SDL_Renderer* { return m_handle; }
+    [[nodiscard]] inline auto GetSurface() const noexcept -> SDL_Surface* { return m_surface; }
+    [[nodiscard]] inline auto GetPixelDensity() const noexcept -> std::float_t { return m_pixelDensity; }
+
+private:
+    auto RecordQuad(SDL_Texture* const texture, const SDL_Rect& area, const SDL_FRect& textureArea, const SDL_Colour& colour, const Layer layer) const -> void;
+
+    auto SetDrawColour(const SDL_Colour& colour) const -> void;
+    auto SetTextureModulation(SDL_Texture* const texture, const SDL_Colour& colour) const -> void;
+
+    auto DestroyPendingTextures() const -> void;
 };
 
 #endif
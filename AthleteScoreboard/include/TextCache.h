@@ -2,30 +2,113 @@
 #ifndef TEXT_CACHE_H
 #define TEXT_CACHE_H
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <span>
 #include <unordered_map>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 
+#include "FontRegistry.h"
+#include "GlyphAtlas.h"
 #include "Renderer.h"
+#include "TextRasteriser.h"
+#include "Utility.h"
 
 class [[nodiscard]] TextCache final
 {
+public:
+    enum class [[nodiscard]] Backend
+    {
+        StringTextures,
+        GlyphAtlas,
+        SignedDistanceFieldAtlas,
+    };
+
+    struct [[nodiscard]] Statistics final
+    {
+        std::uint64_t hits = 0u;
+        std::uint64_t misses = 0u;
+        std::uint64_t glyphHits = 0u;
+        std::uint64_t glyphMisses = 0u;
+        std::uint64_t evictions = 0u;
+        std::size_t bytesResident = 0u;
+    };
+
 private:
+    struct [[nodiscard]] InternedText final
+    {
+        std::string text{ };
+        TextureSize size{ };
+        std::int32_t scaledWidth = 0;
+
+        SDL_Texture* texture = nullptr;
+        std::size_t byteCount = 0u;
+        std::list<TextHandle>::iterator recency{ };
+        bool isPending = false;
+    };
+
     TTF_Font* m_font = nullptr;
     const Renderer* m_renderer = nullptr;
+    Backend m_backend = Backend::GlyphAtlas;
+    std::uint32_t m_targetHeight = 0u;
+
+    std::unordered_map<std::string, TextHandle> m_handleLookup{ };
+    std::vector<InternedText> m_internedTexts{ };
+    std::list<TextHandle> m_recentlyUsedTexts{ };
+    std::size_t m_memoryBudget = 0u;
+    Statistics m_statistics{ };
 
-    std::unordered_map<std::string, SDL_Texture*> m_textureLookup{ };
+    TextRasteriser m_rasteriser{ };
+    std::uint32_t m_pendingTextCount = 0u;
+    std::deque<TextRasteriser::RasterisedText> m_rasterisedTexts{ };
+
+    GlyphAtlas m_glyphAtlas{ };
 
 public:
     TextCache() = default;
-    TextCache(TTF_Font* const font, const Renderer& renderer);
+    TextCache(TTF_Font* const font, const Renderer& renderer, const Backend backend = Backend::GlyphAtlas);
     ~TextCache() noexcept;
 
-    auto Initialise(TTF_Font* const font, const Renderer& renderer) -> void;
+    auto Initialise(TTF_Font* const font, const Renderer& renderer, const Backend backend = Backend::GlyphAtlas, const std::string& atlasCacheFilepath = "") -> void;
+    auto Release() -> void;
+
+    [[nodiscard]] static auto GetAtlasCacheFilepath(const std::string& cacheDirectory, const std::span<const std::byte> fontData, const std::int32_t pointSize, const Backend backend) -> std::string;
 
-    [[nodiscard]] auto Get(const std::string& text) -> SDL_Texture*;
+    [[nodiscard]] auto Intern(const std::string& text) -> TextHandle;
+
+    [[nodiscard]] auto Get(const TextHandle handle) -> SDL_Texture*;
+    [[nodiscard]] inline auto GetTextSize(const TextHandle handle) const -> TextureSize { return m_internedTexts[handle].size; }
+    [[nodiscard]] inline auto GetScaledWidth(const TextHandle handle) const -> std::int32_t { return m_internedTexts[handle].scaledWidth; }
+
+    auto Draw(const TextHandle handle, const SDL_Rect& area, const SDL_Colour& colour) -> void;
+
+    [[nodiscard]] auto GetNumberSize(const std::uint32_t number, const std::string_view suffix = { }) -> TextureSize;
+    [[nodiscard]] auto GetScaledNumberWidth(const std::uint32_t number, const std::string_view suffix = { }) -> std::int32_t;
+    auto DrawNumber(const std::uint32_t number, const SDL_Rect& area, const SDL_Colour& colour, const std::string_view suffix = { }) -> void;
+
+    auto SetMemoryBudget(const std::size_t byteCount) -> void;
+    auto SetTargetHeight(const std::uint32_t targetHeight, const std::float_t pixelDensity = 1.0f) -> void;
+
+    auto StartRasteriser(FontRegistry& fontRegistry, const std::string& fontPath, const std::int32_t pointSize, const std::uint32_t workerCount) -> void;
+    auto ProcessPendingUploads(const std::chrono::steady_clock::time_point deadline) -> void;
+    auto Prewarm(const std::vector<TextHandle>& handles) -> void;
+
+    [[nodiscard]] inline auto HasPendingTexts() const noexcept -> bool { return m_pendingTextCount > 0u; }
+    [[nodiscard]] inline auto GetBackend() const noexcept -> Backend { return m_backend; }
+    [[nodiscard]] auto GetStatistics() const -> Statistics;
+
+private:
+    [[nodiscard]] auto AddTexture(const TextHandle handle, SDL_Surface* textSurface) -> SDL_Texture*;
+    auto EvictColdTextures() -> void;
+    [[nodiscard]] inline auto GetResidentByteCount() const noexcept -> std::size_t { return m_statistics.bytesResident + m_glyphAtlas.GetResidentByteCount(); }
 };
 
 #endif
@@ -0,0 +1,64 @@
+#pragma once
+#ifndef TEXT_RASTERISER_H
+#define TEXT_RASTERISER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include "FontRegistry.h"
+
+class [[nodiscard]] TextRasteriser final
+{
+public:
+    struct [[nodiscard]] RasterisedText final
+    {
+        std::uint32_t id = 0u;
+        SDL_Surface* surface = nullptr;
+    };
+
+private:
+    struct [[nodiscard]] Request final
+    {
+        std::uint32_t id = 0u;
+        std::string text{ };
+    };
+
+    FontRegistry* m_fontRegistry = nullptr;
+    std::vector<TTF_Font*> m_workerFonts{ };
+    std::vector<std::jthread> m_workers{ };
+
+    std::mutex m_requestMutex{ };
+    std::condition_variable_any m_requestCondition{ };
+    std::deque<Request> m_requests{ };
+
+    std::mutex m_resultMutex{ };
+    std::condition_variable m_resultCondition{ };
+    std::vector<RasterisedText> m_results{ };
+
+public:
+    TextRasteriser() = default;
+    ~TextRasteriser() noexcept;
+
+    auto Start(FontRegistry& fontRegistry, const std::string& fontPath, const std::int32_t pointSize, const std::uint32_t workerCount) -> void;
+    auto Stop() -> void;
+
+    auto Enqueue(const std::uint32_t id, std::string text) -> void;
+    [[nodiscard]] auto TakeResults() -> std::vector<RasterisedText>;
+    [[nodiscard]] auto WaitForResults() -> std::vector<RasterisedText>;
+
+    [[nodiscard]] inline auto IsRunning() const noexcept -> bool { return !m_workers.empty(); }
+
+private:
+    auto RunWorker(const std::stop_token stopToken, TTF_Font* const font) -> void;
+};
+
+#endif
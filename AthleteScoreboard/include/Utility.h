@@ -2,19 +2,39 @@
 #ifndef UTILITY_H
 #define UTILITY_H
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string>
+#include <string_view>
 
 #include <SDL2/SDL.h>
 
+using TextHandle = std::uint32_t;
+
 struct [[nodiscard]] TextureSize final
 {
     std::uint32_t width;
     std::uint32_t height;
 };
 
+struct [[nodiscard]] NumberText final
+{
+    std::array<char, 16u> characters{ };
+    std::size_t length = 0u;
+
+    [[nodiscard]] inline auto GetView() const noexcept -> std::string_view { return std::string_view(characters.data(), length); }
+};
+
 [[nodiscard]] extern auto GetTextureSize(SDL_Texture* const texture) -> TextureSize;
+[[nodiscard]] extern auto GetScaledTextureWidth(const TextureSize size, const std::uint32_t targetHeight) -> std::int32_t;
+
+[[nodiscard]] extern auto FormatNumber(const std::uint32_t number, const std::string_view suffix = { }) -> NumberText;
+[[nodiscard]] extern auto GetOrdinalSuffix(const std::uint32_t cardinalNumber) -> std::string_view;
 
 [[nodiscard]] extern auto GetOrdinalNumber(const std::uint32_t cardinalNumber) -> std::string;
 
+[[nodiscard]] extern auto HashBytes(const std::span<const std::byte> bytes, const std::uint64_t seed = 0xCBF29CE484222325u) -> std::uint64_t;
+
 #endif
@@ -23,6 +23,8 @@ public:
     Window(const Size size, const std::string_view title);
     ~Window() noexcept;
 
+    auto Show() const -> void;
+
     [[nodiscard]] auto GetSize() const -> Size;
 
     [[nodiscard]] inline auto IsValid() const noexcept -> bool { return m_handle != nullptr; }
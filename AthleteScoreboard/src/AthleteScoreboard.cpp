@@ -1,6 +1,7 @@
 #include "AthleteScoreboard.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <format>
 #include <functional>
@@ -21,11 +22,16 @@ try
     LoadDimensions(scriptEngine);
     LoadEliminations(scriptEngine);
     LoadColours(scriptEngine);
+    LoadViewport(scriptEngine);
 
-    m_easingFunction = scriptEngine["EASINGS"]["ordering"].get<std::function<auto(std::float_t) -> std::float_t>>();
+    m_orderingEasingCurve = LoadEasingCurve(scriptEngine, "ordering", "out_quad");
+    m_scoreEasingCurve = LoadEasingCurve(scriptEngine, "scores", "linear");
 
     CalculateAthletePositions();
     CalculateNewAthleteScoresAndPositions();
+    FindFollowedAthlete();
+
+    spdlog::info("Using the {} interpolation kernel.", InterpolationKernel::GetInstructionSetName(m_interpolationKernel.GetInstructionSet()));
 
     m_didInitialiseSuccessfully = true;
 }
@@ -33,6 +39,10 @@ catch (const sol::error& error)
 {
     spdlog::error("The following error occurred when loading athletes.lua: {}.", error.what());
 }
+catch (const std::exception& error)
+{
+    spdlog::error("The following error occurred when loading athletes.lua: {}.", error.what());
+}
 catch (...)
 {
     spdlog::error("An unknown error occurred when loading athletes.lua.");
@@ -44,12 +54,12 @@ AthleteScoreboard::~AthleteScoreboard() noexcept
     {
         if (font != nullptr)
         {
-            TTF_CloseFont(font);
+            m_fontRegistry.Release(font);
         }
     }
 }
 
-auto AthleteScoreboard::LoadTextCaches(const ScriptEngine& scriptEngine, const Renderer& renderer) -> void
+auto AthleteScoreboard::LoadTextCaches(const ScriptEngine& scriptEngine, const Renderer& renderer, const bool isRasterisationSynchronous) -> void
 {
     char* applicationBasePathPointer = SDL_GetBasePath();
     const std::string applicationBasePath = applicationBasePathPointer;
@@ -62,38 +72,128 @@ auto AthleteScoreboard::LoadTextCaches(const ScriptEngine& scriptEngine, const R
     std::string eliminatedFontPath = applicationBasePath;
     eliminatedFontPath += scriptEngine["FONTS"]["eliminated"];
 
-    const std::int32_t fontPointSize = static_cast<std::int32_t>(static_cast<std::float_t>(m_dimensions.barHeight) * (72.0f / 96.0f));
+    const std::string textBackendName = scriptEngine["FONTS"]["text_backend"].get_or<std::string>("glyph_atlas");
+    TextCache::Backend textBackend = TextCache::Backend::GlyphAtlas;
+
+    if (textBackendName == "string_textures")
+    {
+        textBackend = TextCache::Backend::StringTextures;
+    }
+    else if (textBackendName == "sdf_atlas")
+    {
+        textBackend = TextCache::Backend::SignedDistanceFieldAtlas;
+    }
+    else if (textBackendName != "glyph_atlas")
+    {
+        throw std::runtime_error(std::format("Unknown text backend \"{}\".", textBackendName));
+    }
 
-    m_athleteFont = TTF_OpenFont(athletesFontPath.c_str(), fontPointSize);
+    const std::float_t pixelDensity = renderer.GetPixelDensity();
 
-    if (m_athleteFont == nullptr)
+    if (pixelDensity != 1.0f)
     {
-        throw std::runtime_error(std::format("Failed to load font at {}. Error: {}.", athletesFontPath, TTF_GetError()));
+        spdlog::info("Rendering at a pixel density of {:.2f}.", pixelDensity);
     }
 
-    m_eliminatedFont = TTF_OpenFont(eliminatedFontPath.c_str(), fontPointSize);
+    std::int32_t fontPointSize = static_cast<std::int32_t>(static_cast<std::float_t>(m_dimensions.barHeight) * pixelDensity * (72.0f / 96.0f));
 
-    if (m_eliminatedFont == nullptr)
+    if (textBackend == TextCache::Backend::SignedDistanceFieldAtlas)
     {
-        throw std::runtime_error(std::format("Failed to load font at {}. Error: {}.", eliminatedFontPath, TTF_GetError()));
+        const std::int32_t defaultDistanceFieldPointSize = 48;
+        fontPointSize = scriptEngine["FONTS"]["sdf_point_size"].get_or(defaultDistanceFieldPointSize);
     }
 
-    m_athleteTextCache.Initialise(m_athleteFont, renderer);
-    m_eliminatedTextCache.Initialise(m_eliminatedFont, renderer);
+    m_athleteFont = m_fontRegistry.Acquire(athletesFontPath, fontPointSize);
+    m_eliminatedFont = m_fontRegistry.Acquire(eliminatedFontPath, fontPointSize);
 
-    m_eliminatedText = m_eliminatedTextCache.Get("ELIMINATED");
-    m_winnerText = m_eliminatedTextCache.Get("WINNER");
+    std::string athleteAtlasCacheFilepath{ };
+    std::string eliminatedAtlasCacheFilepath{ };
+
+    if (scriptEngine["FONTS"]["persistent_cache"].get_or(true))
+    {
+        const std::string cacheDirectory = applicationBasePath + "cache/";
+
+        athleteAtlasCacheFilepath = TextCache::GetAtlasCacheFilepath(cacheDirectory, m_fontRegistry.GetFileData(athletesFontPath), fontPointSize, textBackend);
+        eliminatedAtlasCacheFilepath = TextCache::GetAtlasCacheFilepath(cacheDirectory, m_fontRegistry.GetFileData(eliminatedFontPath), fontPointSize, textBackend);
+    }
+
+    m_athleteTextCache.Initialise(m_athleteFont, renderer, textBackend, athleteAtlasCacheFilepath);
+    m_eliminatedTextCache.Initialise(m_eliminatedFont, renderer, textBackend, eliminatedAtlasCacheFilepath);
+
+    for (auto& athleteDetails : m_athletes.details)
+    {
+        athleteDetails.nameText = m_athleteTextCache.Intern(athleteDetails.name);
+    }
+
+    m_eliminatedText = m_eliminatedTextCache.Intern("ELIMINATED");
+    m_winnerText = m_eliminatedTextCache.Intern("WINNER");
+
+    const std::size_t textCacheBudgetMegabytes = scriptEngine["FONTS"]["text_cache_budget_megabytes"].get_or<std::size_t>(64u);
+    m_athleteTextCache.SetMemoryBudget(textCacheBudgetMegabytes * 1024u * 1024u);
+    m_eliminatedTextCache.SetMemoryBudget(textCacheBudgetMegabytes * 1024u * 1024u);
+
+    const std::uint32_t defaultRasteriserThreadCount = std::max(std::thread::hardware_concurrency(), 2u) - 1u;
+    const std::uint32_t rasteriserThreadCount = isRasterisationSynchronous ? 0u : scriptEngine["FONTS"]["rasteriser_threads"].get_or(defaultRasteriserThreadCount);
+
+    m_athleteTextCache.StartRasteriser(m_fontRegistry, athletesFontPath, fontPointSize, rasteriserThreadCount);
+    m_eliminatedTextCache.StartRasteriser(m_fontRegistry, eliminatedFontPath, fontPointSize, std::min(rasteriserThreadCount, 1u));
+
+    m_athleteTextCache.SetTargetHeight(m_dimensions.barHeight, pixelDensity);
+    m_eliminatedTextCache.SetTargetHeight(m_dimensions.barHeight, pixelDensity);
+
+    UpdateScrollOffset();
+    PrewarmTextCaches();
 
     CalculateMaximumScoreTextWidth();
     CalculatePixelsPerPoint();
+    CalculateLayout();
+}
 
-    LoadOrdinalNumberTexts();
+auto AthleteScoreboard::ReleaseTextCaches() -> void
+{
+    m_athleteTextCache.Release();
+    m_eliminatedTextCache.Release();
 }
 
 auto AthleteScoreboard::Update(const std::float_t deltaTime) -> void
+{
+    constexpr std::float_t FixedTimeStep = 1.0f / 120.0f;
+    constexpr std::float_t MaximumFrameTime = 0.25f;
+    constexpr std::float_t StepTolerance = FixedTimeStep * 0.001f;
+
+    m_accumulatedTime += std::min(deltaTime, MaximumFrameTime);
+
+    // Whole multiples of the step, such as exported frame times, must not lose a step to rounding.
+    while (m_accumulatedTime + StepTolerance >= FixedTimeStep)
+    {
+        Step(FixedTimeStep);
+        m_accumulatedTime -= FixedTimeStep;
+    }
+
+    m_accumulatedTime = std::max(m_accumulatedTime, 0.0f);
+    m_stepInterpolation = m_accumulatedTime / FixedTimeStep;
+
+    if (m_isStepAnimating)
+    {
+        m_needsRender = true;
+    }
+
+    UpdateScrollOffset();
+    UpdateVisibleAthleteLayouts();
+}
+
+auto AthleteScoreboard::Step(const std::float_t timeStep) -> void
 {
     constexpr std::float_t SecondsPerFullInterpolation = 7.5f;
 
+    m_previousInterpolation = m_interpolation;
+
+    const bool wasStepAnimating = m_isStepAnimating;
+    m_isStepAnimating = false;
+
+    std::ranges::copy(m_athletes.currentScores, std::begin(m_athletes.previousScores));
+    std::ranges::copy(m_athletes.currentPositions, std::begin(m_athletes.previousPositions));
+
     switch (m_state)
     {
     case State::Idle:
@@ -103,19 +203,15 @@ auto AthleteScoreboard::Update(const std::float_t deltaTime) -> void
     case State::UpdateScores:
         if (m_interpolation <= 1.0f)
         {
-            for (auto& athlete : m_athletes)
-            {
-                athlete.currentScore = std::lerp(static_cast<std::float_t>(athlete.originalScore), static_cast<std::float_t>(athlete.newScore), m_interpolation);
-            }
+            m_isStepAnimating = true;
 
-            m_interpolation += (1.0f / SecondsPerFullInterpolation) * deltaTime;
+            m_interpolationKernel.InterpolateScores(m_athletes.originalScores, m_athletes.newScores, m_athletes.currentScores, m_scoreEasingCurve.Evaluate(m_interpolation));
+
+            m_interpolation += (1.0f / SecondsPerFullInterpolation) * timeStep;
 
             if (m_interpolation != 1.0f && m_interpolation > 1.0f) [[unlikely]]
             {
-                for (auto& athlete : m_athletes)
-                {
-                    athlete.currentScore = std::lerp(static_cast<std::float_t>(athlete.originalScore), static_cast<std::float_t>(athlete.newScore), 1.0f);
-                }
+                m_interpolationKernel.InterpolateScores(m_athletes.originalScores, m_athletes.newScores, m_athletes.currentScores, 1.0f);
             }
         }
         else if (!m_readyToChangeState)
@@ -128,19 +224,15 @@ auto AthleteScoreboard::Update(const std::float_t deltaTime) -> void
     case State::UpdatePositions:
         if (m_interpolation <= 1.0f)
         {
-            for (auto& athlete : m_athletes)
-            {
-                athlete.currentPosition = std::lerp(static_cast<std::float_t>(athlete.originalPosition), static_cast<std::float_t>(athlete.newPosition), m_easingFunction(m_interpolation));
-            }
+            m_isStepAnimating = true;
+
+            m_interpolationKernel.InterpolatePositions(m_athletes.originalPositions, m_athletes.newPositions, m_athletes.currentPositions, m_orderingEasingCurve.Evaluate(m_interpolation));
 
-            m_interpolation += (1.0f / SecondsPerFullInterpolation) * deltaTime;
+            m_interpolation += (1.0f / SecondsPerFullInterpolation) * timeStep;
 
             if (m_interpolation != 1.0f && m_interpolation > 1.0f) [[unlikely]]
             {
-                for (auto& athlete : m_athletes)
-                {
-                    athlete.currentPosition = std::lerp(static_cast<std::float_t>(athlete.originalPosition), static_cast<std::float_t>(athlete.newPosition), 1.0f);
-                }
+                m_interpolationKernel.InterpolatePositions(m_athletes.originalPositions, m_athletes.newPositions, m_athletes.currentPositions, 1.0f);
             }
         }
         else if (!m_readyToChangeState)
@@ -153,15 +245,19 @@ auto AthleteScoreboard::Update(const std::float_t deltaTime) -> void
     case State::DisplayEliminatedText:
         if (m_interpolation == 0.0f)
         {
-            std::ranges::sort(m_athletes, std::greater{ });
+            std::ranges::sort(
+                m_athletes.standings,
+                [this](const AthleteID lhs, const AthleteID rhs) -> bool { return m_athletes.IsRankedAbove(lhs, rhs, m_athletes.currentScores); }
+            );
 
             for (std::uint32_t newlyEliminatedAthleteCount = 0u;
-                auto& athlete : std::views::reverse(m_athletes))
+                const AthleteID athleteID : std::views::reverse(m_athletes.standings))
             {
-                if (!athlete.isEliminated)
+                if (AthleteDetails& athleteDetails = m_athletes.details[athleteID];
+                    !athleteDetails.isEliminated)
                 {
-                    athlete.isEliminated = true;
-                    m_newlyEliminatedAthleteNames.insert(athlete.name);
+                    athleteDetails.isEliminated = true;
+                    athleteDetails.isNewlyEliminated = true;
 
                     ++newlyEliminatedAthleteCount;
 
@@ -172,18 +268,24 @@ auto AthleteScoreboard::Update(const std::float_t deltaTime) -> void
                 }
             }
 
-            if (!m_athletes.front().isEliminated)
+            if (AthleteDetails& leaderDetails = m_athletes.details[m_athletes.standings.front()];
+                !leaderDetails.isEliminated)
             {
-                m_athletes.front().isWinner = true;
+                leaderDetails.isWinner = true;
             }
         }
 
-        m_interpolation += (1.0f / SecondsPerFullInterpolation) * deltaTime;
+        m_interpolation += (1.0f / SecondsPerFullInterpolation) * timeStep;
+        m_isStepAnimating = true;
 
         if (m_interpolation >= 1.0f)
         {
             m_interpolation = 1.0f;
-            m_newlyEliminatedAthleteNames.clear();
+
+            for (auto& athleteDetails : m_athletes.details)
+            {
+                athleteDetails.isNewlyEliminated = false;
+            }
 
             m_state = State::End;
         }
@@ -193,53 +295,188 @@ auto AthleteScoreboard::Update(const std::float_t deltaTime) -> void
     [[unlikely]] default:
         break;
     }
+
+    if (wasStepAnimating && !m_isStepAnimating)
+    {
+        m_needsRender = true;
+    }
 }
 
 auto AthleteScoreboard::Render(const Renderer& renderer) -> void
 {
+    constexpr std::chrono::microseconds TextUploadTimePerFrame{ 2'000 };
+
+    const auto textUploadDeadline = std::chrono::steady_clock::now() + TextUploadTimePerFrame;
+    m_athleteTextCache.ProcessPendingUploads(textUploadDeadline);
+    m_eliminatedTextCache.ProcessPendingUploads(textUploadDeadline);
+
     renderer.Clear(m_colours.background);
 
     RenderSidebar(renderer);
-    RenderOrdinalNumbers(renderer);
+    RenderOrdinalNumbers();
+
+    FindOverlappingRows();
+    std::uint32_t drawGroup = 0u;
 
-    for (const auto& athlete : m_athletes)
+    for (const AthleteID athleteID : m_athletes.standings)
     {
-        RenderAthleteScoreBar(renderer, athlete);
-        RenderAthleteName(renderer, athlete);
-        RenderAthleteScoreBarText(renderer, athlete);
+        if (!IsRowVisible(GetDisplayedPosition(athleteID)))
+        {
+            continue;
+        }
+
+        renderer.SetDrawGroup(m_isRowOverlapping[athleteID] ? ++drawGroup : 0u);
+
+        RenderAthleteScoreBar(renderer, athleteID);
+        RenderAthleteName(athleteID);
+        RenderAthleteScoreBarText(athleteID);
     }
+
+    renderer.SetDrawGroup(0u);
+
+    m_needsRender = m_athleteTextCache.HasPendingTexts() || m_eliminatedTextCache.HasPendingTexts();
 }
 
 auto AthleteScoreboard::HandleKeyPress(const SDL_Scancode scancode) -> void
 {
-    if (scancode == SDL_SCANCODE_RETURN && m_readyToChangeState)
+    if (scancode == SDL_SCANCODE_F3)
     {
-        switch (m_state)
+        LogTextCacheStatistics();
+    }
+
+    if (scancode == SDL_SCANCODE_RETURN)
+    {
+        AdvanceState();
+    }
+
+    if (m_viewport.isEnabled)
+    {
+        const std::float_t pageDistance = static_cast<std::float_t>(m_viewport.visibleRowCount) * GetRowPitch();
+
+        switch (scancode)
         {
-        case State::Idle:
-            m_state = State::UpdateScores;
-            m_readyToChangeState = false;
-            m_interpolation = 0.0f;
+        case SDL_SCANCODE_UP:
+            ScrollBy(-GetRowPitch());
 
             break;
 
-        case State::UpdateScores:
-            m_state = State::UpdatePositions;
-            m_readyToChangeState = false;
-            m_interpolation = 0.0f;
+        case SDL_SCANCODE_DOWN:
+            ScrollBy(GetRowPitch());
 
             break;
 
-        case State::UpdatePositions:
-            m_state = State::DisplayEliminatedText;
-            m_readyToChangeState = false;
-            m_interpolation = 0.0f;
+        case SDL_SCANCODE_PAGEUP:
+            ScrollBy(-pageDistance);
 
             break;
+
+        case SDL_SCANCODE_PAGEDOWN:
+            ScrollBy(pageDistance);
+
+            break;
+
+        case SDL_SCANCODE_HOME:
+            ScrollBy(-m_contentHeight);
+
+            break;
+
+        case SDL_SCANCODE_END:
+            ScrollBy(m_contentHeight);
+
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+auto AthleteScoreboard::AdvanceState() -> void
+{
+    if (!m_readyToChangeState)
+    {
+        return;
+    }
+
+    switch (m_state)
+    {
+    case State::Idle:
+        m_state = State::UpdateScores;
+        m_readyToChangeState = false;
+        m_interpolation = 0.0f;
+        m_previousInterpolation = 0.0f;
+        m_needsRender = true;
+
+        break;
+
+    case State::UpdateScores:
+        m_state = State::UpdatePositions;
+        m_readyToChangeState = false;
+        m_interpolation = 0.0f;
+        m_previousInterpolation = 0.0f;
+        m_needsRender = true;
+
+        break;
+
+    case State::UpdatePositions:
+        m_state = State::DisplayEliminatedText;
+        m_readyToChangeState = false;
+        m_interpolation = 0.0f;
+        m_previousInterpolation = 0.0f;
+        m_needsRender = true;
+
+        break;
+    }
+}
+
+[[nodiscard]] auto AthleteScoreboard::GetTimeUntilNextUpdate() const -> std::optional<std::chrono::milliseconds>
+{
+    if (m_needsRender || m_isStepAnimating)
+    {
+        return std::chrono::milliseconds::zero();
+    }
+
+    switch (m_state)
+    {
+    case State::UpdateScores:
+    case State::UpdatePositions:
+        if (m_interpolation <= 1.0f || !m_readyToChangeState)
+        {
+            return std::chrono::milliseconds::zero();
         }
+
+        break;
+
+    case State::DisplayEliminatedText:
+        return std::chrono::milliseconds::zero();
+
+    case State::Idle:
+    case State::End:
+    [[unlikely]] default:
+        break;
     }
+
+    return std::nullopt;
 }
 
+auto AthleteScoreboard::LogTextCacheStatistics() const -> void
+{
+    for (const auto& [cacheName, textCache] : { std::make_pair("Athlete", &m_athleteTextCache), std::make_pair("Eliminated", &m_eliminatedTextCache) })
+    {
+        const auto& statistics = textCache->GetStatistics();
+
+        spdlog::info(
+            "{} text cache: {} hits, {} misses, {} glyph hits, {} glyph misses, {} evictions, {} bytes resident.",
+            cacheName,
+            statistics.hits,
+            statistics.misses,
+            statistics.glyphHits,
+            statistics.glyphMisses,
+            statistics.evictions,
+            statistics.bytesResident
+        );
+    }
+}
 
 auto AthleteScoreboard::LoadAthletes(const ScriptEngine& scriptEngine) -> void
 {
@@ -247,20 +484,26 @@ auto AthleteScoreboard::LoadAthletes(const ScriptEngine& scriptEngine) -> void
     {
         const bool isAthleteEliminated = athleteData.as<sol::table>()["is_eliminated"];
 
-        m_athletes.push_back(
-            Athlete{
+        m_athletes.Add(
+            AthleteDetails{
                 .name = athleteName.as<std::string>(),
+                .nameText = 0u,
                 .colour = athleteData.as<sol::table>()["colour"],
                 .pointsToAdd = isAthleteEliminated ? 0 : athleteData.as<sol::table>()["points_to_add"],
                 .isEliminated = isAthleteEliminated,
+                .isNewlyEliminated = false,
                 .isWinner = false,
-                .originalScore = athleteData.as<sol::table>()["current_score"],
-                .currentScore = athleteData.as<sol::table>()["current_score"],
-            }
+            },
+            athleteData.as<sol::table>()["current_score"]
         );
     }
 
-    std::ranges::sort(m_athletes, std::greater());
+    m_athletes.RankNames();
+
+    std::ranges::sort(
+        m_athletes.standings,
+        [this](const AthleteID lhs, const AthleteID rhs) -> bool { return m_athletes.IsRankedAbove(lhs, rhs, m_athletes.currentScores); }
+    );
 }
 
 auto AthleteScoreboard::LoadDimensions(const ScriptEngine& scriptEngine) -> void
@@ -277,9 +520,10 @@ auto AthleteScoreboard::LoadDimensions(const ScriptEngine& scriptEngine) -> void
     m_dimensions.distanceBetweenOrdinalNumbersAndWindowLeft = scriptEngine["DIMENSIONS"]["distance_between_ordinal_numbers_and_window_left"];
     m_dimensions.distanceBetweenEliminatedTextAndWindowRight = scriptEngine["DIMENSIONS"]["distance_between_eliminated_text_and_window_right"];
 
-    m_windowHeight = static_cast<std::float_t>(
-        (static_cast<std::uint32_t>(m_athletes.size()) * (m_dimensions.barHeight + m_dimensions.distanceBetweenBars)) + m_dimensions.distanceBetweenBars
+    m_contentHeight = static_cast<std::float_t>(
+        (static_cast<std::uint32_t>(m_athletes.GetCount()) * (m_dimensions.barHeight + m_dimensions.distanceBetweenBars)) + m_dimensions.distanceBetweenBars
     );
+    m_windowHeight = m_contentHeight;
 }
 
 auto AthleteScoreboard::LoadEliminations(const ScriptEngine& scriptEngine) -> void
@@ -298,15 +542,62 @@ auto AthleteScoreboard::LoadColours(const ScriptEngine& scriptEngine) -> void
     m_colours.winnerText = scriptEngine["COLOURS"]["winner_text"];
 }
 
+auto AthleteScoreboard::LoadViewport(const ScriptEngine& scriptEngine) -> void
+{
+    m_viewport.isEnabled = scriptEngine["VIEWPORT"]["enabled"].get_or(false);
+
+    if (!m_viewport.isEnabled)
+    {
+        return;
+    }
+
+    const std::uint32_t defaultVisibleRowCount = 12u;
+    m_viewport.visibleRowCount = std::max(scriptEngine["VIEWPORT"]["visible_rows"].get_or(defaultVisibleRowCount), 1u);
+    m_viewport.followedAthleteName = scriptEngine["VIEWPORT"]["follow_athlete"].get_or<std::string>("");
+
+    if (m_viewport.visibleRowCount >= static_cast<std::uint32_t>(m_athletes.GetCount()))
+    {
+        m_viewport.isEnabled = false;
+
+        return;
+    }
+
+    m_windowHeight = static_cast<std::float_t>(
+        (m_viewport.visibleRowCount * (m_dimensions.barHeight + m_dimensions.distanceBetweenBars)) + m_dimensions.distanceBetweenBars
+    );
+}
+
+[[nodiscard]] auto AthleteScoreboard::LoadEasingCurve(const ScriptEngine& scriptEngine, const std::string_view easingName, const std::string_view defaultCurveName) const -> EasingCurve
+{
+    const sol::object easing = scriptEngine["EASINGS"][easingName];
+
+    if (easing.is<sol::protected_function>())
+    {
+        return EasingCurve(easing.as<EasingCurve::Function>());
+    }
+
+    const std::string curveName = easing.is<std::string>() ? easing.as<std::string>() : std::string(defaultCurveName);
+
+    if (const auto nativeFunction = EasingCurve::FindNativeFunction(curveName);
+        nativeFunction != nullptr)
+    {
+        return EasingCurve(nativeFunction);
+    }
+
+    throw std::runtime_error(std::format("Unknown easing curve \"{}\" for EASINGS.{}.", curveName, easingName));
+}
+
 auto AthleteScoreboard::CalculateAthletePositions() -> void
 {
     std::int32_t yOffset = static_cast<std::int32_t>(m_dimensions.distanceBetweenBars);
 
-    for (std::size_t i = 0u; i < m_athletes.size(); ++i)
+    for (const AthleteID athleteID : m_athletes.standings)
     {
-        m_athletes[i].originalPosition = static_cast<std::int32_t>(yOffset);
-        m_athletes[i].currentPosition = static_cast<std::float_t>(m_athletes[i].originalPosition);
-        m_athletes[i].currentScore = static_cast<std::float_t>(m_athletes[i].originalScore);
+        m_athletes.originalPositions[athleteID] = yOffset;
+        m_athletes.currentPositions[athleteID] = static_cast<std::float_t>(yOffset);
+        m_athletes.previousPositions[athleteID] = m_athletes.currentPositions[athleteID];
+        m_athletes.currentScores[athleteID] = static_cast<std::float_t>(m_athletes.originalScores[athleteID]);
+        m_athletes.previousScores[athleteID] = m_athletes.currentScores[athleteID];
 
         yOffset += static_cast<std::int32_t>(m_dimensions.barHeight + m_dimensions.distanceBetweenBars);
     }
@@ -314,48 +605,42 @@ auto AthleteScoreboard::CalculateAthletePositions() -> void
 
 auto AthleteScoreboard::CalculateNewAthleteScoresAndPositions() -> void
 {
-    std::vector<Athlete> newAthletes = m_athletes;
     m_maximumScore = 0u;
 
-    for (auto& athlete : newAthletes)
+    for (AthleteID athleteID = 0u; athleteID < static_cast<AthleteID>(m_athletes.GetCount()); ++athleteID)
     {
-        athlete.currentScore += static_cast<std::float_t>(athlete.pointsToAdd);
-        m_maximumScore = std::max(m_maximumScore, static_cast<std::uint32_t>(athlete.currentScore));
-    }
+        AthleteDetails& athleteDetails = m_athletes.details[athleteID];
 
-    std::ranges::sort(newAthletes, std::greater());
+        m_athletes.newScores[athleteID] = static_cast<std::uint32_t>(m_athletes.currentScores[athleteID] + static_cast<std::float_t>(athleteDetails.pointsToAdd));
+        m_maximumScore = std::max(m_maximumScore, m_athletes.newScores[athleteID]);
 
-    for (auto& athlete : m_athletes)
-    {
-        const auto newAthleteLocation = std::ranges::find_if(
-            newAthletes,
-            [&targetName = athlete.name](const Athlete& athlete) -> bool { return athlete.name == targetName; }
-        );
+        athleteDetails.pointsToAdd = 0;
+    }
 
-        const std::size_t newAthleteIndex = newAthleteLocation - std::cbegin(newAthletes);
+    std::vector<AthleteID> newStandings = m_athletes.standings;
 
-        athlete.pointsToAdd = 0;
+    std::ranges::sort(
+        newStandings,
+        [this](const AthleteID lhs, const AthleteID rhs) -> bool { return m_athletes.IsRankedAbove(lhs, rhs, m_athletes.newScores); }
+    );
 
-        athlete.newScore = static_cast<std::uint32_t>(newAthleteLocation->currentScore);
-        athlete.newPosition = static_cast<std::int32_t>(
-            static_cast<std::uint32_t>(newAthleteIndex) * (m_dimensions.barHeight + m_dimensions.distanceBetweenBars) + m_dimensions.distanceBetweenBars
+    for (std::uint32_t newRank = 0u; newRank < static_cast<std::uint32_t>(newStandings.size()); ++newRank)
+    {
+        m_athletes.newPositions[newStandings[newRank]] = static_cast<std::int32_t>(
+            newRank * (m_dimensions.barHeight + m_dimensions.distanceBetweenBars) + m_dimensions.distanceBetweenBars
         );
     }
 }
 
 auto AthleteScoreboard::CalculateMaximumScoreTextWidth() -> void
 {
-    const auto maximumScoreText = m_athleteTextCache.Get(std::to_string(m_maximumScore));
-    const auto [maximumScoreTextWidth, maximumScoreTextHeight] = GetTextureSize(maximumScoreText);
-    const std::float_t maximumScoreRatio = static_cast<std::float_t>(maximumScoreTextHeight) / static_cast<std::float_t>(m_dimensions.barHeight);
-
-    m_maximumScoreTextWidth = static_cast<std::int32_t>(static_cast<std::float_t>(maximumScoreTextWidth) / maximumScoreRatio);
+    m_maximumScoreTextWidth = m_athleteTextCache.GetScaledNumberWidth(m_maximumScore);
 }
 
 auto AthleteScoreboard::CalculatePixelsPerPoint() -> void
 {
-    const auto [eliminatedTextWidth, eliminatedTextHeight] = GetTextureSize(m_eliminatedText);
-    const auto [winnerTextWidth, winnerTextHeight] = GetTextureSize(m_winnerText);
+    const std::int32_t eliminatedTextWidth = m_eliminatedTextCache.GetScaledWidth(m_eliminatedText);
+    const std::int32_t winnerTextWidth = m_eliminatedTextCache.GetScaledWidth(m_winnerText);
 
     const std::int32_t maximumScoreBarLength =
         static_cast<std::int32_t>(m_windowHeight * m_dimensions.aspectRatio) -
@@ -364,156 +649,290 @@ auto AthleteScoreboard::CalculatePixelsPerPoint() -> void
         m_dimensions.minimumScoreBarLength -
         m_dimensions.distanceBetweenBarAndScoreText -
         m_dimensions.distanceBetweenScoreTextAndWindowRight -
-        static_cast<std::int32_t>(std::max(eliminatedTextWidth, winnerTextWidth)) -
+        std::max(eliminatedTextWidth, winnerTextWidth) -
         m_dimensions.distanceBetweenEliminatedTextAndWindowRight;
 
     m_pixelsPerPoint = static_cast<std::float_t>(maximumScoreBarLength) / static_cast<std::float_t>(m_maximumScore);
 }
 
-auto AthleteScoreboard::LoadOrdinalNumberTexts() -> void
+auto AthleteScoreboard::PrewarmTextCaches() -> void
 {
-    for (std::uint32_t i = 1u; i <= static_cast<std::uint32_t>(m_athletes.size()); ++i)
+    const auto prewarmStartTime = std::chrono::steady_clock::now();
+
+    std::vector<TextHandle> athleteTexts{ };
+    athleteTexts.reserve(m_athletes.GetCount());
+
+    for (AthleteID athleteID = 0u; athleteID < static_cast<AthleteID>(m_athletes.GetCount()); ++athleteID)
     {
-        m_ordinalNumberTexts[i] = m_athleteTextCache.Get(GetOrdinalNumber(i));
+        if (IsRowVisible(GetDisplayedPosition(athleteID)))
+        {
+            athleteTexts.push_back(m_athletes.details[athleteID].nameText);
+        }
     }
+
+    m_athleteTextCache.Prewarm(athleteTexts);
+    m_eliminatedTextCache.Prewarm({ m_eliminatedText, m_winnerText });
+
+    const auto [firstVisibleRow, lastVisibleRow] = GetVisibleRowRange();
+
+    for (std::uint32_t i = static_cast<std::uint32_t>(firstVisibleRow) + 1u; i <= static_cast<std::uint32_t>(lastVisibleRow); ++i)
+    {
+        [[maybe_unused]] const auto ordinalTextSize = m_athleteTextCache.GetNumberSize(i, GetOrdinalSuffix(i));
+    }
+
+    const auto prewarmDuration = std::chrono::duration<std::float_t, std::milli>(std::chrono::steady_clock::now() - prewarmStartTime);
+    spdlog::info("Prewarmed text caches for {} of {} athletes in {:.2f} ms.", athleteTexts.size(), m_athletes.GetCount(), prewarmDuration.count());
 }
 
-auto AthleteScoreboard::RenderSidebar(const Renderer& renderer) const -> void
+auto AthleteScoreboard::FindFollowedAthlete() -> void
 {
-    const SDL_Rect sidebarArea{
-        .x = 0,
-        .y = 0,
-        .w = m_dimensions.sidebarWidth,
-        .h = static_cast<std::int32_t>(m_windowHeight),
-    };
+    m_viewport.followedAthleteID = std::nullopt;
+
+    if (!m_viewport.isEnabled || m_viewport.followedAthleteName.empty())
+    {
+        return;
+    }
 
-    renderer.DrawRectangle(sidebarArea, m_colours.sidebar);
+    const auto followedAthleteLocation = std::ranges::find(m_athletes.details, m_viewport.followedAthleteName, &AthleteDetails::name);
+
+    if (followedAthleteLocation == std::cend(m_athletes.details))
+    {
+        spdlog::warn("Cannot follow athlete \"{}\" because they are not in the athletes table.", m_viewport.followedAthleteName);
+        m_viewport.followedAthleteName.clear();
+
+        return;
+    }
+
+    m_viewport.followedAthleteID = static_cast<AthleteID>(followedAthleteLocation - std::cbegin(m_athletes.details));
 }
 
-auto AthleteScoreboard::RenderOrdinalNumbers(const Renderer& renderer) -> void
+auto AthleteScoreboard::ScrollBy(const std::float_t distance) -> void
 {
-    std::int32_t yOffset = static_cast<std::int32_t>(m_dimensions.distanceBetweenBars);
+    m_viewport.followedAthleteName.clear();
+    m_viewport.followedAthleteID = std::nullopt;
+
+    m_viewport.scrollOffset = std::clamp(m_viewport.scrollOffset + distance, 0.0f, m_contentHeight - m_windowHeight);
+    m_needsRender = true;
+
+    UpdateVisibleAthleteLayouts();
+}
 
-    for (std::uint32_t i = 1u; i <= static_cast<std::uint32_t>(m_athletes.size()); ++i)
+auto AthleteScoreboard::UpdateScrollOffset() -> void
+{
+    if (!m_viewport.followedAthleteID.has_value())
     {
-        const auto ordinalText = m_ordinalNumberTexts[i];
-        const auto [ordinalTextWidth, ordinalTextHeight] = GetTextureSize(ordinalText);
-        const std::float_t textureToBarRatio = static_cast<std::float_t>(ordinalTextHeight) / static_cast<std::float_t>(m_dimensions.barHeight);
+        return;
+    }
 
-        const auto proportionalOrdinalTextWidth = static_cast<std::int32_t>(static_cast<std::float_t>(ordinalTextWidth) / textureToBarRatio);
+    const std::float_t centredOffset = GetDisplayedPosition(m_viewport.followedAthleteID.value()) + static_cast<std::float_t>(m_dimensions.barHeight) * 0.5f - m_windowHeight * 0.5f;
 
-        const SDL_Rect currentOrdinalText{
-            .x = m_dimensions.distanceBetweenOrdinalNumbersAndWindowLeft,
-            .y = yOffset,
-            .w = proportionalOrdinalTextWidth,
-            .h = static_cast<std::int32_t>(m_dimensions.barHeight),
-        };
+    m_viewport.scrollOffset = std::clamp(centredOffset, 0.0f, m_contentHeight - m_windowHeight);
+}
 
-        renderer.DrawTexture(ordinalText, currentOrdinalText, m_colours.ordinalText);
+auto AthleteScoreboard::FindOverlappingRows() -> void
+{
+    m_isRowOverlapping.assign(m_athletes.GetCount(), false);
 
-        yOffset += static_cast<std::int32_t>(m_dimensions.barHeight + m_dimensions.distanceBetweenBars);
+    if (m_state != State::UpdatePositions || !m_isStepAnimating)
+    {
+        return;
+    }
+
+    m_rowsByDisplayedPosition = m_athletes.standings;
+    std::ranges::sort(m_rowsByDisplayedPosition, std::less<std::float_t>(), [this](const AthleteID athleteID) -> std::float_t { return GetDisplayedPosition(athleteID); });
+
+    for (std::size_t i = 1u; i < m_rowsByDisplayedPosition.size(); ++i)
+    {
+        const AthleteID upperAthleteID = m_rowsByDisplayedPosition[i - 1u];
+        const AthleteID lowerAthleteID = m_rowsByDisplayedPosition[i];
+
+        if (GetDisplayedPosition(lowerAthleteID) - GetDisplayedPosition(upperAthleteID) < static_cast<std::float_t>(m_dimensions.barHeight))
+        {
+            m_isRowOverlapping[upperAthleteID] = true;
+            m_isRowOverlapping[lowerAthleteID] = true;
+        }
     }
 }
 
-auto AthleteScoreboard::RenderAthleteScoreBar(const Renderer& renderer, const Athlete& athlete) -> void
+[[nodiscard]] auto AthleteScoreboard::IsRowVisible(const std::float_t position) const noexcept -> bool
 {
-    const SDL_Rect athleteScoreBarArea{
-            .x = m_dimensions.sidebarWidth,
-            .y = static_cast<std::int32_t>(athlete.currentPosition),
-            .w = static_cast<std::int32_t>(athlete.currentScore * m_pixelsPerPoint) + m_dimensions.minimumScoreBarLength,
-            .h = static_cast<std::int32_t>(m_dimensions.barHeight),
-    };
+    return position + static_cast<std::float_t>(m_dimensions.barHeight) > m_viewport.scrollOffset && position < m_viewport.scrollOffset + m_windowHeight;
+}
 
-    renderer.DrawRectangle(athleteScoreBarArea, athlete.colour);
+[[nodiscard]] auto AthleteScoreboard::GetVisibleRowRange() const noexcept -> std::pair<std::size_t, std::size_t>
+{
+    const std::float_t rowPitch = GetRowPitch();
+    const std::float_t firstRowPosition = static_cast<std::float_t>(m_dimensions.distanceBetweenBars);
+
+    const std::float_t firstVisibleRow = std::floor((m_viewport.scrollOffset - firstRowPosition) / rowPitch);
+    const std::float_t lastVisibleRow = std::ceil((m_viewport.scrollOffset + m_windowHeight - firstRowPosition) / rowPitch);
+
+    return std::make_pair(
+        static_cast<std::size_t>(std::clamp(firstVisibleRow, 0.0f, static_cast<std::float_t>(m_athletes.GetCount()))),
+        static_cast<std::size_t>(std::clamp(lastVisibleRow, 0.0f, static_cast<std::float_t>(m_athletes.GetCount())))
+    );
 }
 
-auto AthleteScoreboard::RenderAthleteName(const Renderer& renderer, const Athlete& athlete) -> void
+auto AthleteScoreboard::CalculateLayout() -> void
 {
-    const auto athleteNameText = m_athleteTextCache.Get(athlete.name);
-    const auto [nameWidth, nameHeight] = GetTextureSize(athleteNameText);
+    m_ordinalNumberAreas.clear();
+    m_ordinalNumberAreas.reserve(m_athletes.GetCount());
 
-    const std::float_t textureToBarRatio = static_cast<std::float_t>(nameHeight) / static_cast<std::float_t>(m_dimensions.barHeight);
-    const std::int32_t newNameWidth = static_cast<std::int32_t>(static_cast<std::float_t>(nameWidth) / textureToBarRatio);
+    std::int32_t yOffset = static_cast<std::int32_t>(m_dimensions.distanceBetweenBars);
 
-    const SDL_Rect athleteNameArea{
-        .x = m_dimensions.sidebarWidth - newNameWidth - m_dimensions.distanceBetweenNameAndSidebar,
-        .y = static_cast<std::int32_t>(athlete.currentPosition),
-        .w = newNameWidth,
-        .h = static_cast<std::int32_t>(m_dimensions.barHeight),
-    };
+    for (std::uint32_t i = 1u; i <= static_cast<std::uint32_t>(m_athletes.GetCount()); ++i)
+    {
+        m_ordinalNumberAreas.push_back(
+            SDL_Rect{
+                .x = m_dimensions.distanceBetweenOrdinalNumbersAndWindowLeft,
+                .y = yOffset,
+                .w = m_athleteTextCache.GetScaledNumberWidth(i, GetOrdinalSuffix(i)),
+                .h = static_cast<std::int32_t>(m_dimensions.barHeight),
+            }
+        );
 
-    renderer.DrawTexture(athleteNameText, athleteNameArea, athlete.colour);
+        yOffset += static_cast<std::int32_t>(m_dimensions.barHeight + m_dimensions.distanceBetweenBars);
+    }
+
+    for (AthleteID athleteID = 0u; athleteID < static_cast<AthleteID>(m_athletes.GetCount()); ++athleteID)
+    {
+        const std::int32_t nameWidth = m_athleteTextCache.GetScaledWidth(m_athletes.details[athleteID].nameText);
+        const std::uint32_t currentScore = static_cast<std::uint32_t>(m_athletes.currentScores[athleteID]);
+
+        m_athletes.layouts[athleteID] = AthleteLayout{
+            .displayedScore = currentScore,
+            .nameArea = SDL_Rect{
+                .x = m_dimensions.sidebarWidth - nameWidth - m_dimensions.distanceBetweenNameAndSidebar,
+                .y = 0,
+                .w = nameWidth,
+                .h = static_cast<std::int32_t>(m_dimensions.barHeight),
+            },
+            .scoreBarArea = SDL_Rect{
+                .x = m_dimensions.sidebarWidth,
+                .y = 0,
+                .w = 0,
+                .h = static_cast<std::int32_t>(m_dimensions.barHeight),
+            },
+            .scoreTextArea = SDL_Rect{
+                .x = 0,
+                .y = 0,
+                .w = m_athleteTextCache.GetScaledNumberWidth(currentScore),
+                .h = static_cast<std::int32_t>(m_dimensions.barHeight),
+            },
+            .tagArea = SDL_Rect{
+                .x = 0,
+                .y = 0,
+                .w = 0,
+                .h = static_cast<std::int32_t>(m_dimensions.barHeight),
+            },
+        };
+
+        UpdateAthleteLayout(athleteID);
+    }
 }
 
-auto AthleteScoreboard::RenderAthleteScoreBarText(const Renderer& renderer, const Athlete& athlete) -> void
+auto AthleteScoreboard::UpdateVisibleAthleteLayouts() -> void
 {
-    const auto athleteScoreText = m_athleteTextCache.Get(std::to_string(static_cast<std::uint32_t>(athlete.currentScore)));
-    const auto [scoreWidth, scoreHeight] = GetTextureSize(athleteScoreText);
+    for (AthleteID athleteID = 0u; athleteID < static_cast<AthleteID>(m_athletes.GetCount()); ++athleteID)
+    {
+        if (IsRowVisible(GetDisplayedPosition(athleteID)))
+        {
+            UpdateAthleteLayout(athleteID);
+        }
+    }
+}
+
+auto AthleteScoreboard::UpdateAthleteLayout(const AthleteID athleteID) -> void
+{
+    AthleteLayout& layout = m_athletes.layouts[athleteID];
+
+    const std::float_t displayedPosition = GetDisplayedPosition(athleteID) - m_viewport.scrollOffset;
+    const std::float_t displayedScore = std::lerp(m_athletes.previousScores[athleteID], m_athletes.currentScores[athleteID], m_stepInterpolation);
+
+    const std::int32_t yOffset = static_cast<std::int32_t>(displayedPosition);
+    const std::int32_t scoreBarLength = static_cast<std::int32_t>(displayedScore * m_pixelsPerPoint) + m_dimensions.minimumScoreBarLength;
+
+    if (const std::uint32_t currentScore = static_cast<std::uint32_t>(displayedScore);
+        currentScore != layout.displayedScore)
+    {
+        layout.displayedScore = currentScore;
+        layout.scoreTextArea.w = m_athleteTextCache.GetScaledNumberWidth(currentScore);
+    }
+
+    layout.scoreBarArea.w = scoreBarLength;
+    layout.scoreTextArea.x = m_dimensions.sidebarWidth + scoreBarLength + m_dimensions.distanceBetweenBarAndScoreText;
 
-    const std::float_t scoreTextureToBarRatio = static_cast<std::float_t>(scoreHeight) / static_cast<std::float_t>(m_dimensions.barHeight);
-    const std::int32_t newScoreWidth = static_cast<std::int32_t>(static_cast<std::float_t>(scoreWidth) / scoreTextureToBarRatio);
+    layout.tagArea.x = layout.scoreTextArea.x + layout.scoreTextArea.w + m_dimensions.distanceBetweenScoreTextAndEliminatedText;
+    layout.tagArea.w = m_eliminatedTextCache.GetScaledWidth(m_athletes.details[athleteID].isEliminated ? m_eliminatedText : m_winnerText);
+
+    layout.nameArea.y = yOffset;
+    layout.scoreBarArea.y = yOffset;
+    layout.scoreTextArea.y = yOffset;
+    layout.tagArea.y = yOffset;
+}
 
-    const SDL_Rect athleteScoreTextArea{
-        .x = static_cast<std::int32_t>(athlete.currentScore * m_pixelsPerPoint) +
-            m_dimensions.minimumScoreBarLength +
-            m_dimensions.distanceBetweenBarAndScoreText +
-            m_dimensions.sidebarWidth,
-        .y = static_cast<std::int32_t>(athlete.currentPosition),
-        .w = newScoreWidth,
-        .h = static_cast<std::int32_t>(m_dimensions.barHeight),
+auto AthleteScoreboard::RenderSidebar(const Renderer& renderer) const -> void
+{
+    const SDL_Rect sidebarArea{
+        .x = 0,
+        .y = 0,
+        .w = m_dimensions.sidebarWidth,
+        .h = static_cast<std::int32_t>(m_windowHeight),
     };
 
-    renderer.DrawTexture(athleteScoreText, athleteScoreTextArea, m_colours.scoreText);
+    renderer.DrawRectangle(sidebarArea, m_colours.sidebar, Renderer::Layer::Background);
+}
+
+auto AthleteScoreboard::RenderOrdinalNumbers() -> void
+{
+    const auto [firstVisibleRow, lastVisibleRow] = GetVisibleRowRange();
 
-    if (athlete.isEliminated)
+    for (std::size_t row = firstVisibleRow; row < lastVisibleRow; ++row)
     {
-        const auto [eliminatedTextWidth, eliminatedTextHeight] = GetTextureSize(m_eliminatedText);
-        const std::float_t eliminatedTextureToBarRatio = static_cast<std::float_t>(eliminatedTextHeight) / static_cast<std::float_t>(m_dimensions.barHeight);
-        const std::int32_t newEliminatedTextWidth = static_cast<std::int32_t>(static_cast<std::float_t>(eliminatedTextWidth) / eliminatedTextureToBarRatio);
+        const std::uint32_t ordinal = static_cast<std::uint32_t>(row) + 1u;
 
-        const SDL_Rect eliminatedTextArea{
-            .x = static_cast<std::int32_t>(athlete.currentScore * m_pixelsPerPoint) +
-                m_dimensions.minimumScoreBarLength +
-                m_dimensions.distanceBetweenBarAndScoreText +
-                m_dimensions.sidebarWidth +
-                newScoreWidth +
-                m_dimensions.distanceBetweenScoreTextAndEliminatedText,
-            .y = static_cast<std::int32_t>(athlete.currentPosition),
-            .w = newEliminatedTextWidth,
-            .h = static_cast<std::int32_t>(m_dimensions.barHeight),
-        };
+        SDL_Rect ordinalNumberArea = m_ordinalNumberAreas[row];
+        ordinalNumberArea.y = static_cast<std::int32_t>(static_cast<std::float_t>(ordinalNumberArea.y) - m_viewport.scrollOffset);
+
+        m_athleteTextCache.DrawNumber(ordinal, ordinalNumberArea, m_colours.ordinalText, GetOrdinalSuffix(ordinal));
+    }
+}
+
+auto AthleteScoreboard::RenderAthleteScoreBar(const Renderer& renderer, const AthleteID athleteID) const -> void
+{
+    renderer.DrawRectangle(m_athletes.layouts[athleteID].scoreBarArea, m_athletes.details[athleteID].colour, Renderer::Layer::Bars);
+}
+
+auto AthleteScoreboard::RenderAthleteName(const AthleteID athleteID) -> void
+{
+    const AthleteDetails& athleteDetails = m_athletes.details[athleteID];
+
+    m_athleteTextCache.Draw(athleteDetails.nameText, m_athletes.layouts[athleteID].nameArea, athleteDetails.colour);
+}
 
+auto AthleteScoreboard::RenderAthleteScoreBarText(const AthleteID athleteID) -> void
+{
+    const AthleteDetails& athleteDetails = m_athletes.details[athleteID];
+    const AthleteLayout& layout = m_athletes.layouts[athleteID];
+
+    m_athleteTextCache.DrawNumber(layout.displayedScore, layout.scoreTextArea, m_colours.scoreText);
+
+    if (athleteDetails.isEliminated)
+    {
         SDL_Colour eliminatedTextColour = m_colours.eliminatedText;
 
-        if (m_newlyEliminatedAthleteNames.contains(athlete.name))
+        if (athleteDetails.isNewlyEliminated)
         {
-            eliminatedTextColour.a = static_cast<std::uint8_t>(m_interpolation * 255.0f);
-
+            eliminatedTextColour.a = static_cast<std::uint8_t>(GetDisplayedInterpolation() * 255.0f);
         }
 
-        renderer.DrawTexture(m_eliminatedText, eliminatedTextArea, eliminatedTextColour);
+        m_eliminatedTextCache.Draw(m_eliminatedText, layout.tagArea, eliminatedTextColour);
     }
-    else if (m_eliminations.showWinnerText && athlete.isWinner)
+    else if (m_eliminations.showWinnerText && athleteDetails.isWinner)
     {
-        const auto [winnerTextWidth, winnnerTextHeight] = GetTextureSize(m_winnerText);
-        const std::float_t winnerTextureToBarRatio = static_cast<std::float_t>(winnnerTextHeight) / static_cast<std::float_t>(m_dimensions.barHeight);
-        const std::int32_t newEliminatedTextWidth = static_cast<std::int32_t>(static_cast<std::float_t>(winnerTextWidth) / winnerTextureToBarRatio);
-
-        const SDL_Rect winnerTextArea{
-            .x = static_cast<std::int32_t>(athlete.currentScore * m_pixelsPerPoint) +
-            m_dimensions.minimumScoreBarLength +
-            m_dimensions.distanceBetweenBarAndScoreText +
-            m_dimensions.sidebarWidth +
-            newScoreWidth +
-            m_dimensions.distanceBetweenScoreTextAndEliminatedText,
-            .y = static_cast<std::int32_t>(athlete.currentPosition),
-            .w = newEliminatedTextWidth,
-            .h = static_cast<std::int32_t>(m_dimensions.barHeight),
-        };
-
         SDL_Colour winnerTextColour = m_colours.winnerText;
-        winnerTextColour.a = static_cast<std::uint8_t>(m_interpolation * 255.0f);
+        winnerTextColour.a = static_cast<std::uint8_t>(GetDisplayedInterpolation() * 255.0f);
 
-        renderer.DrawTexture(m_winnerText, winnerTextArea, winnerTextColour);
+        m_eliminatedTextCache.Draw(m_winnerText, layout.tagArea, winnerTextColour);
     }
 }
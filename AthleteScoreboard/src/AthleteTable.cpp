@@ -0,0 +1,44 @@
+#include "AthleteTable.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+auto AthleteTable::Add(AthleteDetails&& athleteDetails, const std::uint32_t originalScore) -> AthleteID
+{
+    const auto athleteID = static_cast<AthleteID>(GetCount());
+
+    originalScores.push_back(originalScore);
+    previousScores.push_back(static_cast<std::float_t>(originalScore));
+    currentScores.push_back(static_cast<std::float_t>(originalScore));
+    newScores.push_back(originalScore);
+
+    originalPositions.push_back(0);
+    previousPositions.push_back(0.0f);
+    currentPositions.push_back(0.0f);
+    newPositions.push_back(0);
+
+    details.push_back(std::move(athleteDetails));
+    layouts.emplace_back();
+    nameRanks.push_back(0u);
+
+    standings.push_back(athleteID);
+
+    return athleteID;
+}
+
+auto AthleteTable::RankNames() -> void
+{
+    std::vector<AthleteID> alphabeticalOrder(GetCount());
+    std::iota(std::begin(alphabeticalOrder), std::end(alphabeticalOrder), AthleteID{ 0u });
+
+    std::ranges::sort(
+        alphabeticalOrder,
+        [this](const AthleteID lhs, const AthleteID rhs) -> bool { return details[lhs].name < details[rhs].name; }
+    );
+
+    for (std::uint32_t nameRank = 0u; nameRank < static_cast<std::uint32_t>(alphabeticalOrder.size()); ++nameRank)
+    {
+        nameRanks[alphabeticalOrder[nameRank]] = nameRank;
+    }
+}
@@ -0,0 +1,90 @@
+#include "CommandLine.h"
+
+#include <algorithm>
+#include <charconv>
+#include <span>
+#include <string_view>
+
+#include <spdlog/spdlog.h>
+
+namespace
+{
+    template <typename T>
+    [[nodiscard]] auto ParseNumber(const std::string_view argument, const std::string_view text, const T defaultValue) -> T
+    {
+        T value = defaultValue;
+
+        if (const auto [end, errorCode] = std::from_chars(text.data(), text.data() + text.size(), value);
+            errorCode != std::errc{ } || end != text.data() + text.size())
+        {
+            spdlog::warn("Invalid value \"{}\" for {}; using {}.", text, argument, defaultValue);
+
+            return defaultValue;
+        }
+
+        return value;
+    }
+}
+
+[[nodiscard]] auto ParseCommandLine(const std::int32_t argc, char** const argv) -> CommandLineOptions
+{
+    CommandLineOptions options{ };
+
+    const auto arguments = std::span(argv, static_cast<std::size_t>(argc)).subspan(1u);
+
+    for (std::size_t i = 0u; i < arguments.size(); ++i)
+    {
+        const std::string_view argument = arguments[i];
+        const bool hasValue = i + 1u < arguments.size();
+
+        if (argument == "--headless")
+        {
+            options.isHeadless = true;
+        }
+        else if (argument == "--benchmark")
+        {
+            options.isBenchmark = true;
+        }
+        else if (argument == "--export" && hasValue)
+        {
+            const std::string_view formatName = arguments[++i];
+
+            if (formatName == "raw")
+            {
+                options.exportFormat = FrameExporter::Format::RawRGBA;
+            }
+            else if (formatName == "png")
+            {
+                options.exportFormat = FrameExporter::Format::PNG;
+            }
+            else if (formatName == "qoi")
+            {
+                options.exportFormat = FrameExporter::Format::QOI;
+            }
+            else
+            {
+                spdlog::warn("Unknown export format \"{}\"; expected raw, png or qoi.", formatName);
+            }
+
+            options.isHeadless = true;
+        }
+        else if (argument == "--output" && hasValue)
+        {
+            options.exportPath = arguments[++i];
+        }
+        else if (argument == "--frame-rate" && hasValue)
+        {
+            options.exportFrameRate = std::max(ParseNumber(argument, arguments[++i], options.exportFrameRate), 1u);
+        }
+        else if (argument == "--hold" && hasValue)
+        {
+            options.exportStageHoldSeconds = std::max(ParseNumber(argument, arguments[++i], options.exportStageHoldSeconds), 0.0f);
+        }
+        else
+        {
+            spdlog::warn("Ignoring unknown command-line argument \"{}\".", argument);
+        }
+    }
+
+    return options;
+}
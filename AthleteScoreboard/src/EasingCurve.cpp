@@ -0,0 +1,239 @@
+#include "EasingCurve.h"
+
+#include <algorithm>
+#include <array>
+#include <numbers>
+#include <utility>
+
+namespace
+{
+    constexpr std::float_t BackOvershoot = 1.70158f;
+    constexpr std::float_t BackInOutOvershoot = BackOvershoot * 1.525f;
+
+    constexpr std::float_t ElasticPeriod = (2.0f * std::numbers::pi_v<std::float_t>) / 3.0f;
+    constexpr std::float_t ElasticInOutPeriod = (2.0f * std::numbers::pi_v<std::float_t>) / 4.5f;
+
+    [[nodiscard]] auto Linear(const std::float_t x) noexcept -> std::float_t
+    {
+        return x;
+    }
+
+    [[nodiscard]] auto InQuad(const std::float_t x) noexcept -> std::float_t
+    {
+        return x * x;
+    }
+
+    [[nodiscard]] auto OutQuad(const std::float_t x) noexcept -> std::float_t
+    {
+        return 1.0f - (1.0f - x) * (1.0f - x);
+    }
+
+    [[nodiscard]] auto InOutQuad(const std::float_t x) noexcept -> std::float_t
+    {
+        return x < 0.5f ? 2.0f * x * x : 1.0f - std::pow(-2.0f * x + 2.0f, 2.0f) / 2.0f;
+    }
+
+    [[nodiscard]] auto InCubic(const std::float_t x) noexcept -> std::float_t
+    {
+        return x * x * x;
+    }
+
+    [[nodiscard]] auto OutCubic(const std::float_t x) noexcept -> std::float_t
+    {
+        return 1.0f - std::pow(1.0f - x, 3.0f);
+    }
+
+    [[nodiscard]] auto InOutCubic(const std::float_t x) noexcept -> std::float_t
+    {
+        return x < 0.5f ? 4.0f * x * x * x : 1.0f - std::pow(-2.0f * x + 2.0f, 3.0f) / 2.0f;
+    }
+
+    [[nodiscard]] auto InQuart(const std::float_t x) noexcept -> std::float_t
+    {
+        return x * x * x * x;
+    }
+
+    [[nodiscard]] auto OutQuart(const std::float_t x) noexcept -> std::float_t
+    {
+        return 1.0f - std::pow(1.0f - x, 4.0f);
+    }
+
+    [[nodiscard]] auto InOutQuart(const std::float_t x) noexcept -> std::float_t
+    {
+        return x < 0.5f ? 8.0f * x * x * x * x : 1.0f - std::pow(-2.0f * x + 2.0f, 4.0f) / 2.0f;
+    }
+
+    [[nodiscard]] auto InExpo(const std::float_t x) noexcept -> std::float_t
+    {
+        return x <= 0.0f ? 0.0f : std::pow(2.0f, 10.0f * x - 10.0f);
+    }
+
+    [[nodiscard]] auto OutExpo(const std::float_t x) noexcept -> std::float_t
+    {
+        return x >= 1.0f ? 1.0f : 1.0f - std::pow(2.0f, -10.0f * x);
+    }
+
+    [[nodiscard]] auto InOutExpo(const std::float_t x) noexcept -> std::float_t
+    {
+        if (x <= 0.0f || x >= 1.0f)
+        {
+            return x <= 0.0f ? 0.0f : 1.0f;
+        }
+
+        return x < 0.5f ? std::pow(2.0f, 20.0f * x - 10.0f) / 2.0f : (2.0f - std::pow(2.0f, -20.0f * x + 10.0f)) / 2.0f;
+    }
+
+    [[nodiscard]] auto InBack(const std::float_t x) noexcept -> std::float_t
+    {
+        return (BackOvershoot + 1.0f) * x * x * x - BackOvershoot * x * x;
+    }
+
+    [[nodiscard]] auto OutBack(const std::float_t x) noexcept -> std::float_t
+    {
+        return 1.0f + (BackOvershoot + 1.0f) * std::pow(x - 1.0f, 3.0f) + BackOvershoot * std::pow(x - 1.0f, 2.0f);
+    }
+
+    [[nodiscard]] auto InOutBack(const std::float_t x) noexcept -> std::float_t
+    {
+        return x < 0.5f
+            ? (std::pow(2.0f * x, 2.0f) * ((BackInOutOvershoot + 1.0f) * 2.0f * x - BackInOutOvershoot)) / 2.0f
+            : (std::pow(2.0f * x - 2.0f, 2.0f) * ((BackInOutOvershoot + 1.0f) * (x * 2.0f - 2.0f) + BackInOutOvershoot) + 2.0f) / 2.0f;
+    }
+
+    [[nodiscard]] auto InElastic(const std::float_t x) noexcept -> std::float_t
+    {
+        if (x <= 0.0f || x >= 1.0f)
+        {
+            return x <= 0.0f ? 0.0f : 1.0f;
+        }
+
+        return -std::pow(2.0f, 10.0f * x - 10.0f) * std::sin((x * 10.0f - 10.75f) * ElasticPeriod);
+    }
+
+    [[nodiscard]] auto OutElastic(const std::float_t x) noexcept -> std::float_t
+    {
+        if (x <= 0.0f || x >= 1.0f)
+        {
+            return x <= 0.0f ? 0.0f : 1.0f;
+        }
+
+        return std::pow(2.0f, -10.0f * x) * std::sin((x * 10.0f - 0.75f) * ElasticPeriod) + 1.0f;
+    }
+
+    [[nodiscard]] auto InOutElastic(const std::float_t x) noexcept -> std::float_t
+    {
+        if (x <= 0.0f || x >= 1.0f)
+        {
+            return x <= 0.0f ? 0.0f : 1.0f;
+        }
+
+        return x < 0.5f
+            ? -(std::pow(2.0f, 20.0f * x - 10.0f) * std::sin((20.0f * x - 11.125f) * ElasticInOutPeriod)) / 2.0f
+            : (std::pow(2.0f, -20.0f * x + 10.0f) * std::sin((20.0f * x - 11.125f) * ElasticInOutPeriod)) / 2.0f + 1.0f;
+    }
+
+    [[nodiscard]] auto OutBounce(const std::float_t x) noexcept -> std::float_t
+    {
+        constexpr std::float_t Stiffness = 7.5625f;
+        constexpr std::float_t Stride = 2.75f;
+
+        if (x < 1.0f / Stride)
+        {
+            return Stiffness * x * x;
+        }
+        else if (x < 2.0f / Stride)
+        {
+            const std::float_t offset = x - 1.5f / Stride;
+
+            return Stiffness * offset * offset + 0.75f;
+        }
+        else if (x < 2.5f / Stride)
+        {
+            const std::float_t offset = x - 2.25f / Stride;
+
+            return Stiffness * offset * offset + 0.9375f;
+        }
+        else
+        {
+            const std::float_t offset = x - 2.625f / Stride;
+
+            return Stiffness * offset * offset + 0.984375f;
+        }
+    }
+
+    [[nodiscard]] auto InBounce(const std::float_t x) noexcept -> std::float_t
+    {
+        return 1.0f - OutBounce(1.0f - x);
+    }
+
+    [[nodiscard]] auto InOutBounce(const std::float_t x) noexcept -> std::float_t
+    {
+        return x < 0.5f ? (1.0f - OutBounce(1.0f - 2.0f * x)) / 2.0f : (1.0f + OutBounce(2.0f * x - 1.0f)) / 2.0f;
+    }
+
+    constexpr std::array<std::pair<std::string_view, EasingCurve::NativeFunction>, 22u> NativeFunctions{
+        std::make_pair("linear", &Linear),
+        std::make_pair("in_quad", &InQuad),
+        std::make_pair("out_quad", &OutQuad),
+        std::make_pair("in_out_quad", &InOutQuad),
+        std::make_pair("in_cubic", &InCubic),
+        std::make_pair("out_cubic", &OutCubic),
+        std::make_pair("in_out_cubic", &InOutCubic),
+        std::make_pair("in_quart", &InQuart),
+        std::make_pair("out_quart", &OutQuart),
+        std::make_pair("in_out_quart", &InOutQuart),
+        std::make_pair("in_expo", &InExpo),
+        std::make_pair("out_expo", &OutExpo),
+        std::make_pair("in_out_expo", &InOutExpo),
+        std::make_pair("in_back", &InBack),
+        std::make_pair("out_back", &OutBack),
+        std::make_pair("in_out_back", &InOutBack),
+        std::make_pair("in_elastic", &InElastic),
+        std::make_pair("out_elastic", &OutElastic),
+        std::make_pair("in_out_elastic", &InOutElastic),
+        std::make_pair("in_bounce", &InBounce),
+        std::make_pair("out_bounce", &OutBounce),
+        std::make_pair("in_out_bounce", &InOutBounce),
+    };
+}
+
+[[nodiscard]] auto EasingCurve::FindNativeFunction(const std::string_view name) noexcept -> NativeFunction
+{
+    const auto nativeFunctionLocation = std::ranges::find(NativeFunctions, name, &std::pair<std::string_view, NativeFunction>::first);
+
+    return nativeFunctionLocation != std::cend(NativeFunctions) ? nativeFunctionLocation->second : nullptr;
+}
+
+EasingCurve::EasingCurve(const NativeFunction nativeFunction)
+    : m_nativeFunction(nativeFunction)
+{ }
+
+EasingCurve::EasingCurve(const Function& function)
+{
+    m_samples.reserve(SampleCount + 1u);
+
+    for (std::size_t i = 0u; i <= SampleCount; ++i)
+    {
+        m_samples.push_back(function(static_cast<std::float_t>(i) / static_cast<std::float_t>(SampleCount)));
+    }
+}
+
+[[nodiscard]] auto EasingCurve::Evaluate(const std::float_t x) const noexcept -> std::float_t
+{
+    const std::float_t clampedX = std::clamp(x, 0.0f, 1.0f);
+
+    if (m_nativeFunction != nullptr)
+    {
+        return m_nativeFunction(clampedX);
+    }
+
+    if (m_samples.empty()) [[unlikely]]
+    {
+        return clampedX;
+    }
+
+    const std::float_t samplePosition = clampedX * static_cast<std::float_t>(SampleCount);
+    const std::size_t sampleIndex = std::min(static_cast<std::size_t>(samplePosition), SampleCount - 1u);
+
+    return std::lerp(m_samples[sampleIndex], m_samples[sampleIndex + 1u], samplePosition - static_cast<std::float_t>(sampleIndex));
+}
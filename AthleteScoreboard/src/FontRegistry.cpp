@@ -0,0 +1,123 @@
+#include "FontRegistry.h"
+
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <stdexcept>
+
+FontRegistry::~FontRegistry() noexcept
+{
+    for (const auto& openFont : m_openFonts)
+    {
+        TTF_CloseFont(openFont.font);
+    }
+
+    m_openFonts.clear();
+    m_fontFiles.clear();
+}
+
+[[nodiscard]] auto FontRegistry::Acquire(const std::string& path, const std::int32_t pointSize) -> TTF_Font*
+{
+    const auto existingFont = std::find_if(
+        std::begin(m_openFonts), std::end(m_openFonts),
+        [&path, pointSize](const OpenFont& openFont) -> bool
+        {
+            return openFont.isShared && openFont.pointSize == pointSize && openFont.path == path;
+        }
+    );
+
+    if (existingFont != std::end(m_openFonts))
+    {
+        ++existingFont->referenceCount;
+
+        return existingFont->font;
+    }
+
+    return OpenFontFromFile(path, pointSize, true);
+}
+
+[[nodiscard]] auto FontRegistry::AcquireUnique(const std::string& path, const std::int32_t pointSize) -> TTF_Font*
+{
+    return OpenFontFromFile(path, pointSize, false);
+}
+
+auto FontRegistry::Release(TTF_Font* const font) -> void
+{
+    const auto openFont = std::find_if(
+        std::begin(m_openFonts), std::end(m_openFonts),
+        [font](const OpenFont& candidateFont) -> bool
+        {
+            return candidateFont.font == font;
+        }
+    );
+
+    if (openFont == std::end(m_openFonts) || --openFont->referenceCount > 0u)
+    {
+        return;
+    }
+
+    TTF_CloseFont(openFont->font);
+
+    if (const auto fontFile = m_fontFiles.find(openFont->path);
+        fontFile != std::end(m_fontFiles) && --fontFile->second.referenceCount == 0u)
+    {
+        m_fontFiles.erase(fontFile);
+    }
+
+    m_openFonts.erase(openFont);
+}
+
+[[nodiscard]] auto FontRegistry::GetFileData(const std::string& path) const -> std::span<const std::byte>
+{
+    if (const auto fontFile = m_fontFiles.find(path);
+        fontFile != std::cend(m_fontFiles))
+    {
+        return fontFile->second.file.GetData();
+    }
+
+    return { };
+}
+
+[[nodiscard]] auto FontRegistry::OpenFontFromFile(const std::string& path, const std::int32_t pointSize, const bool isShared) -> TTF_Font*
+{
+    auto [fontFile, wasInserted] = m_fontFiles.try_emplace(path);
+
+    if (wasInserted)
+    {
+        fontFile->second.file = MappedFile(path);
+
+        if (!fontFile->second.file.IsOpen())
+        {
+            m_fontFiles.erase(fontFile);
+
+            throw std::runtime_error(std::format("Failed to map font file at {}.", path));
+        }
+    }
+
+    const auto fontData = fontFile->second.file.GetData();
+    TTF_Font* font = TTF_OpenFontRW(SDL_RWFromConstMem(fontData.data(), static_cast<std::int32_t>(fontData.size())), 1, pointSize);
+
+    if (font == nullptr)
+    {
+        if (fontFile->second.referenceCount == 0u)
+        {
+            m_fontFiles.erase(fontFile);
+        }
+
+        throw std::runtime_error(std::format("Failed to load font at {}. Error: {}.", path, TTF_GetError()));
+    }
+
+    ++fontFile->second.referenceCount;
+
+    m_openFonts.push_back(
+        OpenFont{
+            .font = font,
+            .path = path,
+            .pointSize = pointSize,
+            .referenceCount = 1u,
+            .isShared = isShared,
+        }
+    );
+
+    return font;
+}
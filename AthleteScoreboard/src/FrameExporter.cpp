@@ -0,0 +1,192 @@
+#include "FrameExporter.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+#include <spdlog/spdlog.h>
+
+#include "ImageEncoding.h"
+
+FrameExporter::FrameExporter(const Format format, const std::string& outputPath, const std::uint32_t width, const std::uint32_t height, const std::uint32_t workerCount)
+    : m_format(format), m_outputPath(outputPath), m_width(width), m_height(height)
+{
+    if (m_format == Format::RawRGBA)
+    {
+        if (m_outputPath.empty() || m_outputPath == "-")
+        {
+#ifdef _WIN32
+            _setmode(_fileno(stdout), _O_BINARY);
+#endif
+
+            m_rawStream = stdout;
+        }
+        else
+        {
+            m_rawStream = std::fopen(m_outputPath.c_str(), "wb");
+            m_ownsRawStream = true;
+        }
+
+        if (m_rawStream == nullptr)
+        {
+            throw std::runtime_error(std::format("Failed to open {} for exporting frames.", m_outputPath));
+        }
+
+        return;
+    }
+
+    if (m_outputPath.empty())
+    {
+        m_outputPath = "export";
+    }
+
+    std::error_code errorCode{ };
+    std::filesystem::create_directories(m_outputPath, errorCode);
+
+    if (errorCode)
+    {
+        throw std::runtime_error(std::format("Failed to create export directory {}: {}.", m_outputPath, errorCode.message()));
+    }
+
+    const std::uint32_t encoderCount = std::max(workerCount, 1u);
+    m_maximumQueuedFrameCount = static_cast<std::size_t>(encoderCount) * 2u;
+
+    for (std::uint32_t i = 0u; i < encoderCount; ++i)
+    {
+        m_workers.emplace_back(
+            [this](const std::stop_token stopToken) -> void
+            {
+                RunWorker(stopToken);
+            }
+        );
+    }
+}
+
+FrameExporter::~FrameExporter() noexcept
+{
+    Finish();
+}
+
+auto FrameExporter::Submit(std::vector<std::uint8_t> rgbaPixels) -> void
+{
+    const std::uint64_t frameIndex = m_submittedFrameCount;
+    ++m_submittedFrameCount;
+
+    if (m_format == Format::RawRGBA)
+    {
+        if (std::fwrite(rgbaPixels.data(), 1u, rgbaPixels.size(), m_rawStream) != rgbaPixels.size())
+        {
+            ++m_failedFrameCount;
+        }
+
+        return;
+    }
+
+    {
+        std::unique_lock frameLock(m_frameMutex);
+
+        m_frameSpaceCondition.wait(frameLock, [this]() -> bool { return m_frames.size() < m_maximumQueuedFrameCount; });
+        m_frames.push_back(Frame{ .index = frameIndex, .rgbaPixels = std::move(rgbaPixels) });
+    }
+
+    m_frameAvailableCondition.notify_one();
+}
+
+auto FrameExporter::Finish() -> void
+{
+    if (m_format == Format::RawRGBA)
+    {
+        if (m_rawStream != nullptr)
+        {
+            std::fflush(m_rawStream);
+
+            if (m_ownsRawStream)
+            {
+                std::fclose(m_rawStream);
+            }
+
+            m_rawStream = nullptr;
+        }
+    }
+    else if (!m_workers.empty())
+    {
+        {
+            std::unique_lock frameLock(m_frameMutex);
+            m_frameSpaceCondition.wait(frameLock, [this]() -> bool { return m_frames.empty() && m_framesInProgress == 0u; });
+        }
+
+        for (auto& worker : m_workers)
+        {
+            worker.request_stop();
+        }
+
+        m_frameAvailableCondition.notify_all();
+        m_workers.clear();
+    }
+
+    if (m_failedFrameCount > 0u)
+    {
+        spdlog::error("Failed to write {} of {} exported frames.", m_failedFrameCount, m_submittedFrameCount);
+        m_failedFrameCount = 0u;
+    }
+}
+
+auto FrameExporter::RunWorker(const std::stop_token stopToken) -> void
+{
+    while (!stopToken.stop_requested())
+    {
+        Frame frame{ };
+
+        {
+            std::unique_lock frameLock(m_frameMutex);
+
+            if (!m_frameAvailableCondition.wait(frameLock, stopToken, [this]() -> bool { return !m_frames.empty(); }))
+            {
+                return;
+            }
+
+            frame = std::move(m_frames.front());
+            m_frames.pop_front();
+            ++m_framesInProgress;
+        }
+
+        m_frameSpaceCondition.notify_all();
+
+        const bool didWriteImage = WriteImage(frame);
+
+        {
+            const std::scoped_lock frameLock(m_frameMutex);
+            --m_framesInProgress;
+
+            if (!didWriteImage)
+            {
+                ++m_failedFrameCount;
+            }
+        }
+
+        m_frameSpaceCondition.notify_all();
+    }
+}
+
+auto FrameExporter::WriteImage(const Frame& frame) const -> bool
+{
+    const bool isPNG = m_format == Format::PNG;
+
+    const std::vector<std::uint8_t> imageBytes = isPNG
+        ? EncodePNG(frame.rgbaPixels, m_width, m_height)
+        : EncodeQOI(frame.rgbaPixels, m_width, m_height);
+
+    const std::filesystem::path imagePath = std::filesystem::path(m_outputPath) / std::format("frame_{:06}.{}", frame.index, isPNG ? "png" : "qoi");
+    std::ofstream imageFile(imagePath, std::ios::binary | std::ios::trunc);
+    imageFile.write(reinterpret_cast<const char*>(imageBytes.data()), static_cast<std::streamsize>(imageBytes.size()));
+
+    return static_cast<bool>(imageFile);
+}
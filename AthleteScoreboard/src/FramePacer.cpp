@@ -0,0 +1,174 @@
+#include "FramePacer.h"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <SDL2/SDL.h>
+#include <spdlog/spdlog.h>
+
+namespace
+{
+    auto SleepUntil(const std::chrono::steady_clock::time_point deadline, const std::chrono::steady_clock::duration spinDuration) -> void
+    {
+        if (deadline - std::chrono::steady_clock::now() > spinDuration)
+        {
+            std::this_thread::sleep_until(deadline - spinDuration);
+        }
+
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+FramePacer::FramePacer(const ScriptEngine& scriptEngine)
+{
+    const std::string modeName = scriptEngine["FRAME_PACING"]["mode"].get_or<std::string>("vsync");
+
+    if (modeName == "adaptive_vsync")
+    {
+        m_mode = Mode::AdaptiveVSync;
+    }
+    else if (modeName == "fixed")
+    {
+        m_mode = Mode::FixedRate;
+    }
+    else if (modeName != "vsync")
+    {
+        spdlog::warn("Unknown frame pacing mode \"{}\"; using vsync.", modeName);
+    }
+
+    const std::uint32_t defaultTargetFrameRate = 60u;
+    m_targetFrameRate = std::max(scriptEngine["FRAME_PACING"]["target_frame_rate"].get_or(defaultTargetFrameRate), 1u);
+}
+
+FramePacer::FramePacer(const std::uint32_t targetFrameRate)
+    : m_mode(Mode::FixedRate), m_targetFrameRate(std::max(targetFrameRate, 1u))
+{
+    m_framePeriod = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / static_cast<double>(m_targetFrameRate)));
+
+    Reset();
+    m_reportStart = m_frameStart;
+}
+
+auto FramePacer::Initialise(const Renderer& renderer) -> void
+{
+    SDL_DisplayMode displayMode{ };
+    std::uint32_t refreshRate = m_targetFrameRate;
+
+    if (SDL_GetCurrentDisplayMode(SDL_GetWindowDisplayIndex(SDL_RenderGetWindow(renderer.GetRawHandle())), &displayMode) == 0 && displayMode.refresh_rate > 0)
+    {
+        refreshRate = static_cast<std::uint32_t>(displayMode.refresh_rate);
+    }
+
+    if (m_mode != Mode::FixedRate && SDL_RenderSetVSync(renderer.GetRawHandle(), 1) != 0)
+    {
+        spdlog::warn("Failed to enable vsync ({}); frames will be paced at {} FPS instead.", SDL_GetError(), refreshRate);
+
+        m_mode = Mode::FixedRate;
+        m_targetFrameRate = refreshRate;
+    }
+
+    if (m_mode == Mode::AdaptiveVSync)
+    {
+        SDL_RendererInfo rendererInfo{ };
+        SDL_GetRendererInfo(renderer.GetRawHandle(), &rendererInfo);
+
+        // SDL only exposes late-swap tearing through OpenGL.
+        if (const std::string_view rendererName = rendererInfo.name;
+            (rendererName != "opengl" && rendererName != "opengles2") || SDL_GL_SetSwapInterval(-1) != 0)
+        {
+            spdlog::warn("Adaptive vsync is not supported by the {} renderer; using vsync.", rendererInfo.name);
+
+            m_mode = Mode::VSync;
+        }
+    }
+
+    if (m_mode == Mode::FixedRate)
+    {
+        SDL_RenderSetVSync(renderer.GetRawHandle(), 0);
+    }
+    else
+    {
+        m_targetFrameRate = refreshRate;
+    }
+
+    m_framePeriod = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / static_cast<double>(m_targetFrameRate)));
+
+    Reset();
+    m_reportStart = m_frameStart;
+}
+
+auto FramePacer::WaitForNextFrame(const bool didPresent) -> void
+{
+    Clock::time_point now = Clock::now();
+
+    if (didPresent)
+    {
+        ++m_presentedFrameCount;
+    }
+
+    if (didPresent && m_mode != Mode::FixedRate)
+    {
+        if (now - m_frameStart > m_framePeriod + m_framePeriod / 2)
+        {
+            ++m_missedDeadlineCount;
+        }
+
+        m_frameStart = now;
+        m_frameDeadline = now + m_framePeriod;
+    }
+    else
+    {
+        if (now > m_frameDeadline)
+        {
+            if (didPresent)
+            {
+                ++m_missedDeadlineCount;
+            }
+
+            m_frameDeadline = now;
+        }
+        else
+        {
+            SleepUntil(m_frameDeadline, SpinDuration);
+            now = Clock::now();
+        }
+
+        m_frameStart = m_frameDeadline;
+        m_frameDeadline += m_framePeriod;
+    }
+
+    ReportMissedDeadlines(now);
+}
+
+auto FramePacer::Reset() -> void
+{
+    m_frameStart = Clock::now();
+    m_frameDeadline = m_frameStart + m_framePeriod;
+}
+
+auto FramePacer::ReportMissedDeadlines(const Clock::time_point now) -> void
+{
+    if (now - m_reportStart < ReportInterval)
+    {
+        return;
+    }
+
+    if (m_missedDeadlineCount > 0u)
+    {
+        spdlog::warn(
+            "Missed {} of {} frame deadlines in the last {} seconds.",
+            m_missedDeadlineCount,
+            m_presentedFrameCount,
+            std::chrono::duration_cast<std::chrono::seconds>(now - m_reportStart).count()
+        );
+    }
+
+    m_reportStart = now;
+    m_presentedFrameCount = 0u;
+    m_missedDeadlineCount = 0u;
+}
@@ -0,0 +1,598 @@
+#include "GlyphAtlas.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <type_traits>
+
+#include <spdlog/spdlog.h>
+
+#include "MappedFile.h"
+
+namespace
+{
+    constexpr std::uint32_t TransparentPixel = 0x00FFFFFFu;
+
+    constexpr std::float_t DistanceFieldEdgeValue = 128.0f;
+    constexpr std::float_t DistanceFieldValuesPerPixel = 16.0f;
+}
+
+GlyphAtlas::~GlyphAtlas() noexcept
+{
+    SaveCache();
+    m_pages.clear();
+}
+
+auto GlyphAtlas::Initialise(TTF_Font* const font, const Renderer& renderer, const Mode mode, const std::string& cacheFilepath) -> void
+{
+    Release();
+    m_glyphs.fill(Glyph{ });
+
+    m_font = font;
+    m_renderer = &renderer;
+    m_mode = mode;
+
+    TTF_SetFontSDF(m_font, m_mode == Mode::SignedDistanceField ? SDL_TRUE : SDL_FALSE);
+
+    m_lineHeight = TTF_FontHeight(m_font);
+    m_ascent = TTF_FontAscent(m_font);
+
+    m_targetHeight = 0u;
+    SetTargetHeight(static_cast<std::uint32_t>(m_lineHeight));
+
+    m_cacheFilepath = cacheFilepath;
+    m_hasUncachedGlyphs = false;
+
+    if (!m_cacheFilepath.empty() && !LoadCache())
+    {
+        spdlog::info("No usable glyph cache at {}; glyphs will be rasterised.", m_cacheFilepath);
+    }
+
+    for (std::uint8_t previousDigit = 0u; previousDigit < 10u; ++previousDigit)
+    {
+        [[maybe_unused]] const Glyph& digitGlyph = GetGlyph(static_cast<std::uint8_t>('0' + previousDigit));
+
+        for (std::uint8_t digit = 0u; digit < 10u; ++digit)
+        {
+            m_digitKerning[previousDigit][digit] = TTF_GetFontKerningSizeGlyphs32(m_font, '0' + previousDigit, '0' + digit);
+        }
+    }
+}
+
+auto GlyphAtlas::Release() -> void
+{
+    SaveCache();
+
+    if (m_renderer != nullptr)
+    {
+        for (const auto& page : m_pages)
+        {
+            m_renderer->DestroyTexture(page.texture);
+        }
+    }
+
+    m_pages.clear();
+    m_renderer = nullptr;
+}
+
+auto GlyphAtlas::SetTargetHeight(const std::uint32_t targetHeight) -> void
+{
+    if (m_mode != Mode::SignedDistanceField || targetHeight == 0u || targetHeight == m_targetHeight)
+    {
+        return;
+    }
+
+    m_targetHeight = targetHeight;
+
+    const std::float_t atlasPixelsPerTargetPixel = static_cast<std::float_t>(m_lineHeight) / static_cast<std::float_t>(m_targetHeight);
+    const std::float_t rampWidth = DistanceFieldValuesPerPixel * atlasPixelsPerTargetPixel;
+
+    for (std::uint32_t distance = 0u; distance < static_cast<std::uint32_t>(m_distanceCoverage.size()); ++distance)
+    {
+        const std::float_t coverage = std::clamp((static_cast<std::float_t>(distance) - DistanceFieldEdgeValue) / rampWidth + 0.5f, 0.0f, 1.0f);
+        m_distanceCoverage[distance] = static_cast<std::uint8_t>(std::lround(coverage * 255.0f));
+    }
+
+    for (auto& page : m_pages)
+    {
+        ResolveDistances(page, SDL_Rect{ .x = 0, .y = 0, .w = PageSize, .h = PageSize });
+        page.isDirty = true;
+    }
+}
+
+[[nodiscard]] auto GlyphAtlas::MeasureText(const std::string_view text) -> std::int32_t
+{
+    const auto [left, right] = CalculateTextExtents(text);
+
+    return right - left;
+}
+
+auto GlyphAtlas::DrawText(const std::string_view text, const SDL_Rect& area, const SDL_Colour& colour) -> void
+{
+    const TextExtents extents = CalculateTextExtents(text);
+
+    const std::int32_t textWidth = extents.right - extents.left;
+
+    if (textWidth <= 0 || m_lineHeight <= 0)
+    {
+        return;
+    }
+
+    UploadDirtyPages();
+
+    const std::float_t horizontalScale = static_cast<std::float_t>(area.w) / static_cast<std::float_t>(textWidth);
+    const std::float_t verticalScale = static_cast<std::float_t>(area.h) / static_cast<std::float_t>(m_lineHeight);
+
+    std::int32_t penX = -extents.left;
+    std::uint8_t previousCharacter = 0u;
+
+    for (const char textCharacter : text)
+    {
+        const auto character = static_cast<std::uint8_t>(textCharacter);
+        const Glyph& glyph = m_glyphs[character];
+
+        if (previousCharacter != 0u)
+        {
+            penX += GetKerning(previousCharacter, character);
+        }
+
+        if (glyph.sourceArea.w > 0 && glyph.sourceArea.h > 0)
+        {
+            const std::int32_t left = static_cast<std::int32_t>(std::lround(static_cast<std::float_t>(penX + glyph.offsetX) * horizontalScale));
+            const std::int32_t right = static_cast<std::int32_t>(std::lround(static_cast<std::float_t>(penX + glyph.offsetX + glyph.sourceArea.w) * horizontalScale));
+            const std::int32_t top = static_cast<std::int32_t>(std::lround(static_cast<std::float_t>(glyph.offsetY) * verticalScale));
+            const std::int32_t bottom = static_cast<std::int32_t>(std::lround(static_cast<std::float_t>(glyph.offsetY + glyph.sourceArea.h) * verticalScale));
+
+            const SDL_Rect glyphArea{
+                .x = area.x + left,
+                .y = area.y + top,
+                .w = right - left,
+                .h = bottom - top,
+            };
+
+            m_renderer->DrawTexture(m_pages[glyph.page].texture, glyph.sourceArea, glyphArea, Renderer::Layer::Text, colour);
+        }
+
+        penX += glyph.advance;
+        previousCharacter = character;
+    }
+}
+
+[[nodiscard]] auto GlyphAtlas::GetGlyph(const std::uint8_t character) -> const Glyph&
+{
+    if (!m_glyphs[character].isLoaded) [[unlikely]]
+    {
+        ++m_glyphMissCount;
+        m_glyphs[character] = RasteriseGlyph(character);
+    }
+    else
+    {
+        ++m_glyphHitCount;
+    }
+
+    return m_glyphs[character];
+}
+
+[[nodiscard]] auto GlyphAtlas::GetResidentByteCount() const noexcept -> std::size_t
+{
+    constexpr std::size_t PageTextureByteCount = static_cast<std::size_t>(PageSize * PageSize) * sizeof(std::uint32_t);
+
+    std::size_t residentByteCount = 0u;
+
+    for (const auto& page : m_pages)
+    {
+        residentByteCount += PageTextureByteCount + page.pixels.size() * sizeof(std::uint32_t) + page.distances.size() * sizeof(std::uint8_t);
+    }
+
+    return residentByteCount;
+}
+
+[[nodiscard]] auto GlyphAtlas::GetKerning(const std::uint8_t previousCharacter, const std::uint8_t character) const -> std::int32_t
+{
+    if (previousCharacter >= '0' && previousCharacter <= '9' && character >= '0' && character <= '9')
+    {
+        return m_digitKerning[previousCharacter - '0'][character - '0'];
+    }
+
+    return TTF_GetFontKerningSizeGlyphs32(m_font, previousCharacter, character);
+}
+
+[[nodiscard]] auto GlyphAtlas::GetPageTexture(const std::uint32_t page) -> SDL_Texture*
+{
+    UploadDirtyPages();
+
+    return m_pages[page].texture;
+}
+
+[[nodiscard]] auto GlyphAtlas::CalculateTextExtents(const std::string_view text) -> TextExtents
+{
+    TextExtents extents{ .left = 0, .right = 0 };
+    std::int32_t penX = 0;
+    std::uint8_t previousCharacter = 0u;
+
+    for (const char textCharacter : text)
+    {
+        const auto character = static_cast<std::uint8_t>(textCharacter);
+        const Glyph& glyph = GetGlyph(character);
+
+        if (previousCharacter != 0u)
+        {
+            penX += GetKerning(previousCharacter, character);
+        }
+
+        extents.left = std::min(extents.left, penX + glyph.offsetX);
+        extents.right = std::max(extents.right, penX + glyph.offsetX + glyph.sourceArea.w);
+        penX += glyph.advance;
+
+        previousCharacter = character;
+    }
+
+    extents.right = std::max(extents.right, penX);
+
+    return extents;
+}
+
+[[nodiscard]] auto GlyphAtlas::RasteriseGlyph(const std::uint8_t character) -> Glyph
+{
+    Glyph glyph{
+        .isLoaded = true,
+    };
+
+    std::int32_t minimumX = 0;
+    std::int32_t maximumX = 0;
+    std::int32_t minimumY = 0;
+    std::int32_t maximumY = 0;
+    std::int32_t advance = 0;
+
+    if (TTF_GlyphMetrics32(m_font, character, &minimumX, &maximumX, &minimumY, &maximumY, &advance) != 0)
+    {
+        spdlog::error("Failed to query metrics for glyph {}: {}.", character, TTF_GetError());
+
+        return glyph;
+    }
+
+    glyph.advance = advance;
+    glyph.offsetX = std::min(0, minimumX);
+    glyph.offsetY = std::min(0, m_ascent - maximumY);
+
+    SDL_Surface* renderedSurface = TTF_RenderGlyph32_Blended(m_font, character, SDL_Colour{ 0xFFu, 0xFFu, 0xFFu, SDL_ALPHA_OPAQUE });
+
+    if (renderedSurface == nullptr)
+    {
+        return glyph;
+    }
+
+    SDL_Surface* glyphSurface = SDL_ConvertSurfaceFormat(renderedSurface, SDL_PIXELFORMAT_ARGB8888, 0u);
+    SDL_FreeSurface(renderedSurface);
+    renderedSurface = nullptr;
+
+    if (glyphSurface == nullptr)
+    {
+        spdlog::error("Failed to convert pixel surface for glyph {}.", character);
+
+        return glyph;
+    }
+
+    if (const auto allocatedArea = AllocateArea(glyphSurface->w, glyphSurface->h);
+        allocatedArea.has_value())
+    {
+        const auto [pageIndex, position] = allocatedArea.value();
+        Page& page = m_pages[pageIndex];
+
+        const SDL_Rect glyphArea{
+            .x = position.x,
+            .y = position.y,
+            .w = glyphSurface->w,
+            .h = glyphSurface->h,
+        };
+
+        SDL_LockSurface(glyphSurface);
+
+        for (std::int32_t row = 0; row < glyphSurface->h; ++row)
+        {
+            const auto sourceRow = reinterpret_cast<const std::uint32_t*>(static_cast<const std::uint8_t*>(glyphSurface->pixels) + static_cast<std::size_t>(row * glyphSurface->pitch));
+            const std::size_t pageOffset = static_cast<std::size_t>((position.y + row) * PageSize + position.x);
+
+            if (m_mode == Mode::SignedDistanceField)
+            {
+                for (std::int32_t column = 0; column < glyphSurface->w; ++column)
+                {
+                    page.distances[pageOffset + static_cast<std::size_t>(column)] = static_cast<std::uint8_t>(sourceRow[column] >> 24u);
+                }
+            }
+            else
+            {
+                std::memcpy(page.pixels.data() + pageOffset, sourceRow, static_cast<std::size_t>(glyphSurface->w) * sizeof(std::uint32_t));
+            }
+        }
+
+        SDL_UnlockSurface(glyphSurface);
+
+        if (m_mode == Mode::SignedDistanceField)
+        {
+            ResolveDistances(page, glyphArea);
+        }
+
+        page.isDirty = true;
+        m_hasUncachedGlyphs = true;
+
+        glyph.page = pageIndex;
+        glyph.sourceArea = glyphArea;
+    }
+    else
+    {
+        spdlog::error("Failed to find space in the glyph atlas for glyph {}.", character);
+    }
+
+    SDL_FreeSurface(glyphSurface);
+    glyphSurface = nullptr;
+
+    return glyph;
+}
+
+auto GlyphAtlas::ResolveDistances(Page& page, const SDL_Rect& area) const -> void
+{
+    for (std::int32_t row = area.y; row < area.y + area.h; ++row)
+    {
+        const std::size_t rowOffset = static_cast<std::size_t>(row * PageSize);
+
+        for (std::int32_t column = area.x; column < area.x + area.w; ++column)
+        {
+            const std::size_t pixelOffset = rowOffset + static_cast<std::size_t>(column);
+            const std::uint32_t coverage = m_distanceCoverage[page.distances[pixelOffset]];
+
+            page.pixels[pixelOffset] = (coverage << 24u) | TransparentPixel;
+        }
+    }
+}
+
+[[nodiscard]] auto GlyphAtlas::CreatePage() -> bool
+{
+    SDL_Texture* pageTexture = SDL_CreateTexture(m_renderer->GetRawHandle(), SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, PageSize, PageSize);
+
+    if (pageTexture == nullptr)
+    {
+        spdlog::error("Failed to create glyph atlas page: {}.", SDL_GetError());
+
+        return false;
+    }
+
+    SDL_SetTextureBlendMode(pageTexture, SDL_BLENDMODE_BLEND);
+
+    if (m_mode == Mode::SignedDistanceField)
+    {
+        SDL_SetTextureScaleMode(pageTexture, SDL_ScaleModeLinear);
+    }
+
+    m_pages.push_back(
+        Page{
+            .texture = pageTexture,
+            .pixels = std::vector<std::uint32_t>(static_cast<std::size_t>(PageSize * PageSize), TransparentPixel),
+            .distances = std::vector<std::uint8_t>(m_mode == Mode::SignedDistanceField ? static_cast<std::size_t>(PageSize * PageSize) : 0u, 0u),
+            .shelfX = 0,
+            .shelfY = 0,
+            .shelfHeight = 0,
+            .isDirty = true,
+        }
+    );
+
+    return true;
+}
+
+[[nodiscard]] auto GlyphAtlas::AllocateArea(const std::int32_t width, const std::int32_t height) -> std::optional<std::pair<std::uint32_t, SDL_Point>>
+{
+    if (width + GlyphPadding > PageSize || height + GlyphPadding > PageSize)
+    {
+        return std::nullopt;
+    }
+
+    if (!m_pages.empty())
+    {
+        Page& page = m_pages.back();
+
+        if (page.shelfX + width + GlyphPadding > PageSize)
+        {
+            page.shelfX = 0;
+            page.shelfY += page.shelfHeight + GlyphPadding;
+            page.shelfHeight = 0;
+        }
+
+        if (page.shelfY + height + GlyphPadding <= PageSize)
+        {
+            const SDL_Point position{ .x = page.shelfX, .y = page.shelfY };
+
+            page.shelfX += width + GlyphPadding;
+            page.shelfHeight = std::max(page.shelfHeight, height);
+
+            return std::make_pair(static_cast<std::uint32_t>(m_pages.size() - 1u), position);
+        }
+    }
+
+    if (!CreatePage())
+    {
+        return std::nullopt;
+    }
+
+    Page& page = m_pages.back();
+    page.shelfX = width + GlyphPadding;
+    page.shelfHeight = height;
+
+    return std::make_pair(static_cast<std::uint32_t>(m_pages.size() - 1u), SDL_Point{ .x = 0, .y = 0 });
+}
+
+auto GlyphAtlas::UploadDirtyPages() -> void
+{
+    for (auto& page : m_pages)
+    {
+        if (page.isDirty)
+        {
+            SDL_UpdateTexture(page.texture, nullptr, page.pixels.data(), PageSize * static_cast<std::int32_t>(sizeof(std::uint32_t)));
+            page.isDirty = false;
+        }
+    }
+}
+
+auto GlyphAtlas::SaveCache() -> void
+{
+    if (m_cacheFilepath.empty() || !m_hasUncachedGlyphs)
+    {
+        return;
+    }
+
+    const std::filesystem::path cachePath(m_cacheFilepath);
+    std::filesystem::path temporaryPath = cachePath;
+    temporaryPath += ".tmp";
+
+    std::error_code errorCode{ };
+    std::filesystem::create_directories(cachePath.parent_path(), errorCode);
+
+    {
+        std::ofstream cacheFile(temporaryPath, std::ios::binary | std::ios::trunc);
+
+        const CacheHeader header{
+            .magic = CacheMagic,
+            .version = CacheVersion,
+            .mode = static_cast<std::uint32_t>(m_mode),
+            .pageSize = PageSize,
+            .lineHeight = m_lineHeight,
+            .ascent = m_ascent,
+            .pageCount = static_cast<std::uint32_t>(m_pages.size()),
+        };
+
+        cacheFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        cacheFile.write(reinterpret_cast<const char*>(m_glyphs.data()), sizeof(m_glyphs));
+
+        for (const auto& page : m_pages)
+        {
+            const CachedPage cachedPage{
+                .shelfX = page.shelfX,
+                .shelfY = page.shelfY,
+                .shelfHeight = page.shelfHeight,
+            };
+
+            cacheFile.write(reinterpret_cast<const char*>(&cachedPage), sizeof(cachedPage));
+        }
+
+        for (const auto& page : m_pages)
+        {
+            if (m_mode == Mode::SignedDistanceField)
+            {
+                cacheFile.write(reinterpret_cast<const char*>(page.distances.data()), static_cast<std::streamsize>(page.distances.size()));
+            }
+            else
+            {
+                cacheFile.write(reinterpret_cast<const char*>(page.pixels.data()), static_cast<std::streamsize>(page.pixels.size() * sizeof(std::uint32_t)));
+            }
+        }
+
+        if (!cacheFile)
+        {
+            spdlog::warn("Failed to write glyph cache to {}.", temporaryPath.string());
+
+            return;
+        }
+    }
+
+    std::filesystem::rename(temporaryPath, cachePath, errorCode);
+
+    if (errorCode)
+    {
+        spdlog::warn("Failed to replace glyph cache at {}: {}.", m_cacheFilepath, errorCode.message());
+
+        return;
+    }
+
+    m_hasUncachedGlyphs = false;
+}
+
+[[nodiscard]] auto GlyphAtlas::LoadCache() -> bool
+{
+    static_assert(std::is_trivially_copyable_v<Glyph>);
+
+    const MappedFile cacheFile(m_cacheFilepath);
+
+    if (!cacheFile.IsOpen())
+    {
+        return false;
+    }
+
+    const auto cacheData = cacheFile.GetData();
+
+    if (cacheData.size() < sizeof(CacheHeader) + sizeof(m_glyphs))
+    {
+        return false;
+    }
+
+    CacheHeader header{ };
+    std::memcpy(&header, cacheData.data(), sizeof(header));
+
+    if (header.magic != CacheMagic || header.version != CacheVersion || header.mode != static_cast<std::uint32_t>(m_mode) ||
+        header.pageSize != PageSize || header.lineHeight != m_lineHeight || header.ascent != m_ascent)
+    {
+        return false;
+    }
+
+    const std::size_t pageByteCount = static_cast<std::size_t>(PageSize * PageSize) * (m_mode == Mode::SignedDistanceField ? sizeof(std::uint8_t) : sizeof(std::uint32_t));
+    const std::size_t pagesOffset = sizeof(CacheHeader) + sizeof(m_glyphs) + header.pageCount * sizeof(CachedPage);
+
+    if (cacheData.size() != pagesOffset + header.pageCount * pageByteCount)
+    {
+        return false;
+    }
+
+    std::memcpy(m_glyphs.data(), cacheData.data() + sizeof(CacheHeader), sizeof(m_glyphs));
+
+    const bool areGlyphsValid = std::ranges::all_of(m_glyphs, [pageCount = header.pageCount](const Glyph& glyph)
+    {
+        return !glyph.isLoaded || (
+            glyph.page < pageCount &&
+            glyph.sourceArea.x >= 0 && glyph.sourceArea.y >= 0 && glyph.sourceArea.w >= 0 && glyph.sourceArea.h >= 0 &&
+            glyph.sourceArea.w <= PageSize - glyph.sourceArea.x && glyph.sourceArea.h <= PageSize - glyph.sourceArea.y
+        );
+    });
+
+    if (!areGlyphsValid)
+    {
+        m_glyphs.fill(Glyph{ });
+        spdlog::warn("The glyph cache at {} contains invalid glyphs; it will be rebuilt.", m_cacheFilepath);
+
+        return false;
+    }
+
+    for (std::uint32_t pageIndex = 0u; pageIndex < header.pageCount; ++pageIndex)
+    {
+        if (!CreatePage())
+        {
+            m_glyphs.fill(Glyph{ });
+
+            return false;
+        }
+
+        CachedPage cachedPage{ };
+        std::memcpy(&cachedPage, cacheData.data() + sizeof(CacheHeader) + sizeof(m_glyphs) + pageIndex * sizeof(CachedPage), sizeof(cachedPage));
+
+        Page& page = m_pages.back();
+        page.shelfX = cachedPage.shelfX;
+        page.shelfY = cachedPage.shelfY;
+        page.shelfHeight = cachedPage.shelfHeight;
+
+        const std::byte* const pageData = cacheData.data() + pagesOffset + pageIndex * pageByteCount;
+
+        if (m_mode == Mode::SignedDistanceField)
+        {
+            std::memcpy(page.distances.data(), pageData, pageByteCount);
+            ResolveDistances(page, SDL_Rect{ .x = 0, .y = 0, .w = PageSize, .h = PageSize });
+        }
+        else
+        {
+            SDL_UpdateTexture(page.texture, nullptr, pageData, PageSize * static_cast<std::int32_t>(sizeof(std::uint32_t)));
+            std::memcpy(page.pixels.data(), pageData, pageByteCount);
+            page.isDirty = false;
+        }
+    }
+
+    return true;
+}
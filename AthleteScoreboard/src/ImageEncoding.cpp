@@ -0,0 +1,225 @@
+#include "ImageEncoding.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
+namespace
+{
+    constexpr auto CRCTable = []() -> std::array<std::uint32_t, 256u>
+    {
+        std::array<std::uint32_t, 256u> table{ };
+
+        for (std::uint32_t i = 0u; i < 256u; ++i)
+        {
+            std::uint32_t value = i;
+
+            for (std::uint32_t bit = 0u; bit < 8u; ++bit)
+            {
+                value = (value & 1u) != 0u ? 0xEDB88320u ^ (value >> 1u) : value >> 1u;
+            }
+
+            table[i] = value;
+        }
+
+        return table;
+    }();
+
+    auto AppendBigEndian(std::vector<std::uint8_t>& bytes, const std::uint32_t value) -> void
+    {
+        bytes.push_back(static_cast<std::uint8_t>(value >> 24u));
+        bytes.push_back(static_cast<std::uint8_t>(value >> 16u));
+        bytes.push_back(static_cast<std::uint8_t>(value >> 8u));
+        bytes.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    auto AppendPNGChunk(std::vector<std::uint8_t>& bytes, const std::string_view type, const std::span<const std::uint8_t> data) -> void
+    {
+        AppendBigEndian(bytes, static_cast<std::uint32_t>(data.size()));
+
+        const std::size_t typeOffset = bytes.size();
+        bytes.insert(std::end(bytes), std::begin(type), std::end(type));
+        bytes.insert(std::end(bytes), std::begin(data), std::end(data));
+
+        std::uint32_t crc = 0xFFFFFFFFu;
+
+        for (std::size_t i = typeOffset; i < bytes.size(); ++i)
+        {
+            crc = CRCTable[(crc ^ bytes[i]) & 0xFFu] ^ (crc >> 8u);
+        }
+
+        AppendBigEndian(bytes, crc ^ 0xFFFFFFFFu);
+    }
+}
+
+[[nodiscard]] auto EncodePNG(const std::span<const std::uint8_t> rgbaPixels, const std::uint32_t width, const std::uint32_t height) -> std::vector<std::uint8_t>
+{
+    constexpr std::array<std::uint8_t, 8u> Signature{ 0x89u, 'P', 'N', 'G', '\r', '\n', 0x1Au, '\n' };
+    constexpr std::size_t MaximumStoredBlockSize = 0xFFFFu;
+
+    const std::size_t rowSize = static_cast<std::size_t>(width) * 4u;
+
+    std::vector<std::uint8_t> scanlines{ };
+    scanlines.reserve((rowSize + 1u) * height);
+
+    for (std::uint32_t row = 0u; row < height; ++row)
+    {
+        scanlines.push_back(0u);
+
+        const auto rowPixels = rgbaPixels.subspan(row * rowSize, rowSize);
+        scanlines.insert(std::end(scanlines), std::begin(rowPixels), std::end(rowPixels));
+    }
+
+    std::vector<std::uint8_t> imageData{ 0x78u, 0x01u };
+    imageData.reserve(scanlines.size() + (scanlines.size() / MaximumStoredBlockSize + 1u) * 5u + 6u);
+
+    std::uint32_t adlerLow = 1u;
+    std::uint32_t adlerHigh = 0u;
+
+    for (std::size_t blockStart = 0u; blockStart < scanlines.size() || blockStart == 0u; blockStart += MaximumStoredBlockSize)
+    {
+        const std::size_t blockSize = std::min(MaximumStoredBlockSize, scanlines.size() - blockStart);
+        const bool isFinalBlock = blockStart + blockSize >= scanlines.size();
+
+        imageData.push_back(isFinalBlock ? 1u : 0u);
+        imageData.push_back(static_cast<std::uint8_t>(blockSize));
+        imageData.push_back(static_cast<std::uint8_t>(blockSize >> 8u));
+        imageData.push_back(static_cast<std::uint8_t>(~blockSize));
+        imageData.push_back(static_cast<std::uint8_t>(~blockSize >> 8u));
+
+        for (std::size_t i = blockStart; i < blockStart + blockSize; ++i)
+        {
+            imageData.push_back(scanlines[i]);
+
+            adlerLow = (adlerLow + scanlines[i]) % 65521u;
+            adlerHigh = (adlerHigh + adlerLow) % 65521u;
+        }
+
+        if (isFinalBlock)
+        {
+            break;
+        }
+    }
+
+    AppendBigEndian(imageData, (adlerHigh << 16u) | adlerLow);
+
+    std::vector<std::uint8_t> header{ };
+    AppendBigEndian(header, width);
+    AppendBigEndian(header, height);
+    header.insert(std::end(header), { 8u, 6u, 0u, 0u, 0u });
+
+    std::vector<std::uint8_t> bytes(std::begin(Signature), std::end(Signature));
+    bytes.reserve(imageData.size() + 64u);
+
+    AppendPNGChunk(bytes, "IHDR", header);
+    AppendPNGChunk(bytes, "IDAT", imageData);
+    AppendPNGChunk(bytes, "IEND", { });
+
+    return bytes;
+}
+
+[[nodiscard]] auto EncodeQOI(const std::span<const std::uint8_t> rgbaPixels, const std::uint32_t width, const std::uint32_t height) -> std::vector<std::uint8_t>
+{
+    constexpr std::uint8_t IndexOperation = 0x00u;
+    constexpr std::uint8_t DifferenceOperation = 0x40u;
+    constexpr std::uint8_t LumaOperation = 0x80u;
+    constexpr std::uint8_t RunOperation = 0xC0u;
+    constexpr std::uint8_t RGBOperation = 0xFEu;
+    constexpr std::uint8_t RGBAOperation = 0xFFu;
+    constexpr std::uint32_t MaximumRunLength = 62u;
+
+    struct [[nodiscard]] Pixel final
+    {
+        std::uint8_t r;
+        std::uint8_t g;
+        std::uint8_t b;
+        std::uint8_t a;
+
+        [[nodiscard]] inline auto operator ==(const Pixel&) const noexcept -> bool = default;
+        [[nodiscard]] inline auto GetHash() const noexcept -> std::uint32_t { return (r * 3u + g * 5u + b * 7u + a * 11u) % 64u; }
+    };
+
+    std::vector<std::uint8_t> bytes{ 'q', 'o', 'i', 'f' };
+    bytes.reserve(rgbaPixels.size() + 22u);
+
+    AppendBigEndian(bytes, width);
+    AppendBigEndian(bytes, height);
+    bytes.push_back(4u);
+    bytes.push_back(0u);
+
+    std::array<Pixel, 64u> seenPixels{ };
+    Pixel previousPixel{ .r = 0u, .g = 0u, .b = 0u, .a = 0xFFu };
+    std::uint32_t runLength = 0u;
+
+    for (std::size_t offset = 0u; offset < rgbaPixels.size(); offset += 4u)
+    {
+        const Pixel pixel{
+            .r = rgbaPixels[offset],
+            .g = rgbaPixels[offset + 1u],
+            .b = rgbaPixels[offset + 2u],
+            .a = rgbaPixels[offset + 3u],
+        };
+
+        if (pixel == previousPixel)
+        {
+            ++runLength;
+
+            if (runLength == MaximumRunLength || offset + 4u == rgbaPixels.size())
+            {
+                bytes.push_back(static_cast<std::uint8_t>(RunOperation | (runLength - 1u)));
+                runLength = 0u;
+            }
+
+            continue;
+        }
+
+        if (runLength > 0u)
+        {
+            bytes.push_back(static_cast<std::uint8_t>(RunOperation | (runLength - 1u)));
+            runLength = 0u;
+        }
+
+        const std::uint32_t hash = pixel.GetHash();
+
+        if (seenPixels[hash] == pixel)
+        {
+            bytes.push_back(static_cast<std::uint8_t>(IndexOperation | hash));
+        }
+        else if (pixel.a == previousPixel.a)
+        {
+            const auto redDifference = static_cast<std::int8_t>(pixel.r - previousPixel.r);
+            const auto greenDifference = static_cast<std::int8_t>(pixel.g - previousPixel.g);
+            const auto blueDifference = static_cast<std::int8_t>(pixel.b - previousPixel.b);
+
+            const auto redGreenDifference = static_cast<std::int8_t>(redDifference - greenDifference);
+            const auto blueGreenDifference = static_cast<std::int8_t>(blueDifference - greenDifference);
+
+            if (redDifference >= -2 && redDifference <= 1 && greenDifference >= -2 && greenDifference <= 1 && blueDifference >= -2 && blueDifference <= 1)
+            {
+                bytes.push_back(static_cast<std::uint8_t>(DifferenceOperation | ((redDifference + 2) << 4) | ((greenDifference + 2) << 2) | (blueDifference + 2)));
+            }
+            else if (greenDifference >= -32 && greenDifference <= 31 && redGreenDifference >= -8 && redGreenDifference <= 7 && blueGreenDifference >= -8 && blueGreenDifference <= 7)
+            {
+                bytes.push_back(static_cast<std::uint8_t>(LumaOperation | (greenDifference + 32)));
+                bytes.push_back(static_cast<std::uint8_t>(((redGreenDifference + 8) << 4) | (blueGreenDifference + 8)));
+            }
+            else
+            {
+                bytes.insert(std::end(bytes), { RGBOperation, pixel.r, pixel.g, pixel.b });
+            }
+        }
+        else
+        {
+            bytes.insert(std::end(bytes), { RGBAOperation, pixel.r, pixel.g, pixel.b, pixel.a });
+        }
+
+        seenPixels[hash] = pixel;
+        previousPixel = pixel;
+    }
+
+    bytes.insert(std::end(bytes), { 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u });
+
+    return bytes;
+}
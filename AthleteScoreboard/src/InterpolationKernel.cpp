@@ -0,0 +1,258 @@
+#include "InterpolationKernel.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <type_traits>
+#include <vector>
+
+#include <SDL2/SDL.h>
+#include <spdlog/spdlog.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define INTERPOLATION_KERNEL_X86 1
+    #include <immintrin.h>
+#else
+    #define INTERPOLATION_KERNEL_X86 0
+#endif
+
+#if INTERPOLATION_KERNEL_X86 && (defined(__GNUC__) || defined(__clang__))
+    #define INTERPOLATION_KERNEL_AVX2_TARGET __attribute__((target("avx2")))
+#else
+    #define INTERPOLATION_KERNEL_AVX2_TARGET
+#endif
+
+namespace
+{
+    template <typename T>
+    auto InterpolateScalar(const T* const originalValues, const T* const newValues, std::float_t* const currentValues, const std::size_t count, const std::float_t interpolation) noexcept -> void
+    {
+        for (std::size_t i = 0u; i < count; ++i)
+        {
+            const std::float_t originalValue = static_cast<std::float_t>(originalValues[i]);
+
+            currentValues[i] = originalValue + interpolation * (static_cast<std::float_t>(newValues[i]) - originalValue);
+        }
+    }
+
+#if INTERPOLATION_KERNEL_X86
+    template <typename T>
+    [[nodiscard]] inline auto ConvertToFloatSSE2(const __m128i values) noexcept -> __m128
+    {
+        if constexpr (std::is_signed_v<T>)
+        {
+            return _mm_cvtepi32_ps(values);
+        }
+        else
+        {
+            // Before AVX-512 there is no unsigned conversion; each 16-bit half converts exactly, so only the final add rounds.
+            const __m128 highHalves = _mm_cvtepi32_ps(_mm_srli_epi32(values, 16));
+            const __m128 lowHalves = _mm_cvtepi32_ps(_mm_and_si128(values, _mm_set1_epi32(0xFFFF)));
+
+            return _mm_add_ps(_mm_mul_ps(highHalves, _mm_set1_ps(65'536.0f)), lowHalves);
+        }
+    }
+
+    template <typename T>
+    auto InterpolateSSE2(const T* const originalValues, const T* const newValues, std::float_t* const currentValues, const std::size_t count, const std::float_t interpolation) noexcept -> void
+    {
+        constexpr std::size_t LaneCount = 4u;
+
+        const __m128 interpolations = _mm_set1_ps(interpolation);
+        std::size_t i = 0u;
+
+        for (; i + LaneCount <= count; i += LaneCount)
+        {
+            const __m128 originalLanes = ConvertToFloatSSE2<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(originalValues + i)));
+            const __m128 newLanes = ConvertToFloatSSE2<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(newValues + i)));
+
+            _mm_storeu_ps(currentValues + i, _mm_add_ps(originalLanes, _mm_mul_ps(interpolations, _mm_sub_ps(newLanes, originalLanes))));
+        }
+
+        InterpolateScalar(originalValues + i, newValues + i, currentValues + i, count - i, interpolation);
+    }
+
+    template <typename T>
+    [[nodiscard]] INTERPOLATION_KERNEL_AVX2_TARGET inline auto ConvertToFloatAVX2(const __m256i values) noexcept -> __m256
+    {
+        if constexpr (std::is_signed_v<T>)
+        {
+            return _mm256_cvtepi32_ps(values);
+        }
+        else
+        {
+            const __m256 highHalves = _mm256_cvtepi32_ps(_mm256_srli_epi32(values, 16));
+            const __m256 lowHalves = _mm256_cvtepi32_ps(_mm256_and_si256(values, _mm256_set1_epi32(0xFFFF)));
+
+            return _mm256_add_ps(_mm256_mul_ps(highHalves, _mm256_set1_ps(65'536.0f)), lowHalves);
+        }
+    }
+
+    template <typename T>
+    INTERPOLATION_KERNEL_AVX2_TARGET auto InterpolateAVX2(const T* const originalValues, const T* const newValues, std::float_t* const currentValues, const std::size_t count, const std::float_t interpolation) noexcept -> void
+    {
+        constexpr std::size_t LaneCount = 8u;
+
+        const __m256 interpolations = _mm256_set1_ps(interpolation);
+        std::size_t i = 0u;
+
+        for (; i + LaneCount <= count; i += LaneCount)
+        {
+            const __m256 originalLanes = ConvertToFloatAVX2<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(originalValues + i)));
+            const __m256 newLanes = ConvertToFloatAVX2<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(newValues + i)));
+
+            _mm256_storeu_ps(currentValues + i, _mm256_add_ps(originalLanes, _mm256_mul_ps(interpolations, _mm256_sub_ps(newLanes, originalLanes))));
+        }
+
+        InterpolateScalar(originalValues + i, newValues + i, currentValues + i, count - i, interpolation);
+    }
+#endif
+}
+
+[[nodiscard]] auto InterpolationKernel::IsSupported(const InstructionSet instructionSet) noexcept -> bool
+{
+    switch (instructionSet)
+    {
+#if INTERPOLATION_KERNEL_X86
+    case InstructionSet::SSE2:
+        return SDL_HasSSE2() == SDL_TRUE;
+
+    case InstructionSet::AVX2:
+        return SDL_HasAVX2() == SDL_TRUE;
+#endif
+
+    case InstructionSet::Scalar:
+        return true;
+
+    [[unlikely]] default:
+        return false;
+    }
+}
+
+[[nodiscard]] auto InterpolationKernel::GetBestInstructionSet() noexcept -> InstructionSet
+{
+    for (const auto instructionSet : { InstructionSet::AVX2, InstructionSet::SSE2 })
+    {
+        if (IsSupported(instructionSet))
+        {
+            return instructionSet;
+        }
+    }
+
+    return InstructionSet::Scalar;
+}
+
+[[nodiscard]] auto InterpolationKernel::GetInstructionSetName(const InstructionSet instructionSet) noexcept -> std::string_view
+{
+    switch (instructionSet)
+    {
+    case InstructionSet::SSE2:
+        return "SSE2";
+
+    case InstructionSet::AVX2:
+        return "AVX2";
+
+    case InstructionSet::Scalar:
+    [[unlikely]] default:
+        return "scalar";
+    }
+}
+
+InterpolationKernel::InterpolationKernel(const InstructionSet instructionSet)
+    : m_instructionSet(IsSupported(instructionSet) ? instructionSet : InstructionSet::Scalar)
+{
+    switch (m_instructionSet)
+    {
+#if INTERPOLATION_KERNEL_X86
+    case InstructionSet::SSE2:
+        m_interpolateScores = &InterpolateSSE2<std::uint32_t>;
+        m_interpolatePositions = &InterpolateSSE2<std::int32_t>;
+
+        break;
+
+    case InstructionSet::AVX2:
+        m_interpolateScores = &InterpolateAVX2<std::uint32_t>;
+        m_interpolatePositions = &InterpolateAVX2<std::int32_t>;
+
+        break;
+#endif
+
+    case InstructionSet::Scalar:
+    [[unlikely]] default:
+        m_interpolateScores = &InterpolateScalar<std::uint32_t>;
+        m_interpolatePositions = &InterpolateScalar<std::int32_t>;
+
+        break;
+    }
+}
+
+auto InterpolationKernel::InterpolateScores(const std::span<const std::uint32_t> originalScores, const std::span<const std::uint32_t> newScores, const std::span<std::float_t> currentScores, const std::float_t interpolation) const noexcept -> void
+{
+    m_interpolateScores(originalScores.data(), newScores.data(), currentScores.data(), currentScores.size(), interpolation);
+}
+
+auto InterpolationKernel::InterpolatePositions(const std::span<const std::int32_t> originalPositions, const std::span<const std::int32_t> newPositions, const std::span<std::float_t> currentPositions, const std::float_t interpolation) const noexcept -> void
+{
+    m_interpolatePositions(originalPositions.data(), newPositions.data(), currentPositions.data(), currentPositions.size(), interpolation);
+}
+
+auto RunInterpolationKernelBenchmark() -> void
+{
+    constexpr std::array<std::size_t, 4u> AthleteCounts{ 1'000u, 10'000u, 100'000u, 1'000'000u };
+    constexpr std::size_t InterpolationsPerRun = 256u * 1'000'000u;
+    constexpr std::size_t StepsPerAnimation = 900u;
+
+    std::float_t checksum = 0.0f;
+
+    for (const std::size_t athleteCount : AthleteCounts)
+    {
+        std::vector<std::uint32_t> originalScores(athleteCount);
+        std::vector<std::uint32_t> newScores(athleteCount);
+        std::vector<std::int32_t> originalPositions(athleteCount);
+        std::vector<std::int32_t> newPositions(athleteCount);
+        std::vector<std::float_t> currentValues(athleteCount);
+
+        for (std::size_t i = 0u; i < athleteCount; ++i)
+        {
+            originalScores[i] = static_cast<std::uint32_t>(i % 1'000u);
+            newScores[i] = originalScores[i] + static_cast<std::uint32_t>((i * 7u) % 50u);
+            originalPositions[i] = static_cast<std::int32_t>(i * 49u);
+            newPositions[i] = static_cast<std::int32_t>((athleteCount - i - 1u) * 49u);
+        }
+
+        const std::size_t stepCount = std::max(InterpolationsPerRun / (athleteCount * 2u), std::size_t{ 1u });
+
+        for (const auto instructionSet : { InterpolationKernel::InstructionSet::Scalar, InterpolationKernel::InstructionSet::SSE2, InterpolationKernel::InstructionSet::AVX2 })
+        {
+            if (!InterpolationKernel::IsSupported(instructionSet))
+            {
+                continue;
+            }
+
+            const InterpolationKernel kernel(instructionSet);
+            const auto startTime = std::chrono::steady_clock::now();
+
+            for (std::size_t step = 0u; step < stepCount; ++step)
+            {
+                const std::float_t interpolation = static_cast<std::float_t>(step % StepsPerAnimation) / static_cast<std::float_t>(StepsPerAnimation);
+
+                kernel.InterpolateScores(originalScores, newScores, currentValues, interpolation);
+                kernel.InterpolatePositions(originalPositions, newPositions, currentValues, interpolation);
+                checksum += currentValues[step % athleteCount];
+            }
+
+            const auto duration = std::chrono::duration<std::float_t>(std::chrono::steady_clock::now() - startTime);
+            const std::float_t athletesPerSecond = static_cast<std::float_t>(stepCount * athleteCount * 2u) / duration.count();
+
+            spdlog::info(
+                "{:>9} athletes, {:<6}: {:>8.1f} M interpolations/s, {:>10.2f} us per step.",
+                athleteCount,
+                InterpolationKernel::GetInstructionSetName(instructionSet),
+                athletesPerSecond / 1'000'000.0f,
+                (duration.count() * 1'000'000.0f) / static_cast<std::float_t>(stepCount)
+            );
+        }
+    }
+
+    spdlog::debug("Interpolation benchmark checksum: {}.", checksum);
+}
@@ -1,25 +1,61 @@
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
+#include <thread>
 
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
 
 #include "AthleteScoreboard.h"
+#include "CommandLine.h"
+#include "FrameExporter.h"
+#include "FramePacer.h"
+#include "InterpolationKernel.h"
 #include "Renderer.h"
 #include "ScriptEngine.h"
 #include "Window.h"
 
-auto main([[maybe_unused]] const std::int32_t argc, [[maybe_unused]] char** const argv) -> int
+auto main(const std::int32_t argc, char** const argv) -> int
 {
-    if (SDL_Init(SDL_INIT_EVERYTHING) != 0)
+    const CommandLineOptions options = ParseCommandLine(argc, argv);
+
+    if (options.isBenchmark)
+    {
+        RunInterpolationKernelBenchmark();
+
+        return EXIT_SUCCESS;
+    }
+
+    if (options.exportFormat == FrameExporter::Format::RawRGBA && (options.exportPath.empty() || options.exportPath == "-"))
+    {
+        spdlog::set_default_logger(spdlog::stderr_color_mt("stderr"));
+    }
+
+    const auto waitForAcknowledgement = [&options]() -> void
+    {
+        if (!options.isHeadless)
+        {
+            std::cin.get();
+        }
+    };
+
+#ifdef _WIN32
+    SDL_SetHint(SDL_HINT_WINDOWS_DPI_AWARENESS, "permonitorv2");
+    SDL_SetHint(SDL_HINT_WINDOWS_DPI_SCALING, "1");
+#endif
+
+    if (SDL_Init(options.isHeadless ? SDL_INIT_TIMER | SDL_INIT_EVENTS : SDL_INIT_EVERYTHING) != 0)
     {
         spdlog::error("Failed to initialise SDL2: {}.", SDL_GetError());
-        std::cin.get();
+        waitForAcknowledgement();
 
         return EXIT_FAILURE;
     }
@@ -27,7 +63,7 @@ auto main([[maybe_unused]] const std::int32_t argc, [[maybe_unused]] char** cons
     if (TTF_Init() != 0)
     {
         spdlog::error("Failed to initialise SDL2_TTF: {}.", TTF_GetError());
-        std::cin.get();
+        waitForAcknowledgement();
 
         SDL_Quit();
 
@@ -40,7 +76,7 @@ auto main([[maybe_unused]] const std::int32_t argc, [[maybe_unused]] char** cons
         if (!scriptEngine.IsValid())
         {
             spdlog::error("Failed to load athletes.toml file or it had an error.");
-            std::cin.get();
+            waitForAcknowledgement();
 
             TTF_Quit();
             SDL_Quit();
@@ -52,7 +88,7 @@ auto main([[maybe_unused]] const std::int32_t argc, [[maybe_unused]] char** cons
 
         if (!athleteScoreboard.DidInitialiseSuccessfully())
         {
-            std::cin.get();
+            waitForAcknowledgement();
 
             TTF_Quit();
             SDL_Quit();
@@ -60,31 +96,35 @@ auto main([[maybe_unused]] const std::int32_t argc, [[maybe_unused]] char** cons
             return EXIT_FAILURE;
         }
 
-        const Window window(
-            Window::Size{
-                .width = static_cast<std::uint32_t>(athleteScoreboard.GetWindowHeight() * athleteScoreboard.GetAspectRatio()),
-                .height = static_cast<std::uint32_t>(athleteScoreboard.GetWindowHeight()),
-            },
-            "Athlete Scoreboard"
-        );
+        const Window::Size windowSize{
+            .width = static_cast<std::uint32_t>(athleteScoreboard.GetWindowHeight() * athleteScoreboard.GetAspectRatio()),
+            .height = static_cast<std::uint32_t>(athleteScoreboard.GetWindowHeight()),
+        };
 
-        if (!window.IsValid())
+        std::optional<Window> window = std::nullopt;
+
+        if (!options.isHeadless)
         {
-            spdlog::error("Failed to create window: {}", SDL_GetError());
-            std::cin.get();
+            window.emplace(windowSize, "Athlete Scoreboard");
 
-            TTF_Quit();
-            SDL_Quit();
+            if (!window->IsValid())
+            {
+                spdlog::error("Failed to create window: {}", SDL_GetError());
+                waitForAcknowledgement();
 
-            return EXIT_FAILURE;
+                TTF_Quit();
+                SDL_Quit();
+
+                return EXIT_FAILURE;
+            }
         }
 
-        const Renderer renderer(window);
+        const Renderer renderer = options.isHeadless ? Renderer(windowSize) : Renderer(window.value());
 
         if (!renderer.IsValid())
         {
             spdlog::error("Failed to create renderer: {}", SDL_GetError());
-            std::cin.get();
+            waitForAcknowledgement();
 
             TTF_Quit();
             SDL_Quit();
@@ -94,12 +134,14 @@ auto main([[maybe_unused]] const std::int32_t argc, [[maybe_unused]] char** cons
 
         try
         {
-            athleteScoreboard.LoadTextCaches(scriptEngine, renderer);
+            athleteScoreboard.LoadTextCaches(scriptEngine, renderer, options.exportFormat.has_value());
         }
         catch (const std::runtime_error& error)
         {
             spdlog::error("The following error occurred when loading the fonts: {}.", error.what());
-            std::cin.get();
+            waitForAcknowledgement();
+
+            athleteScoreboard.ReleaseTextCaches();
 
             TTF_Quit();
             SDL_Quit();
@@ -109,7 +151,9 @@ auto main([[maybe_unused]] const std::int32_t argc, [[maybe_unused]] char** cons
         catch (...)
         {
             spdlog::error("An unknown error occurred when loading the fonts.");
-            std::cin.get();
+            waitForAcknowledgement();
+
+            athleteScoreboard.ReleaseTextCaches();
 
             TTF_Quit();
             SDL_Quit();
@@ -117,46 +161,173 @@ auto main([[maybe_unused]] const std::int32_t argc, [[maybe_unused]] char** cons
             return EXIT_FAILURE;
         }
 
+        std::optional<FrameExporter> frameExporter = std::nullopt;
+        std::uint32_t stageHoldFrameCount = 0u;
+
+        if (options.exportFormat.has_value())
+        {
+            const Window::Size outputSize = renderer.GetOutputSize();
+
+            try
+            {
+                frameExporter.emplace(
+                    options.exportFormat.value(),
+                    options.exportPath,
+                    outputSize.width,
+                    outputSize.height,
+                    std::max(std::thread::hardware_concurrency(), 2u) - 1u
+                );
+            }
+            catch (const std::runtime_error& error)
+            {
+                spdlog::error("The following error occurred when starting the export: {}.", error.what());
+
+                athleteScoreboard.ReleaseTextCaches();
+
+                TTF_Quit();
+                SDL_Quit();
+
+                return EXIT_FAILURE;
+            }
+
+            spdlog::info("Exporting {}x{} frames at {} FPS.", outputSize.width, outputSize.height, options.exportFrameRate);
+            stageHoldFrameCount = static_cast<std::uint32_t>(std::lround(options.exportStageHoldSeconds * static_cast<std::float_t>(options.exportFrameRate)));
+        }
+
+        std::optional<FramePacer> framePacer = std::nullopt;
+
+        if (!options.isHeadless)
+        {
+            framePacer.emplace(scriptEngine);
+            framePacer->Initialise(renderer);
+
+            window->Show();
+        }
+        else if (!frameExporter.has_value())
+        {
+            framePacer.emplace(options.exportFrameRate);
+        }
+
         std::atomic_bool isRunning = true;
         auto tickCount = std::chrono::steady_clock::now();
 
+        const auto handleEvent = [&isRunning, &athleteScoreboard](const SDL_Event& event) -> void
+        {
+            switch (event.type)
+            {
+            case SDL_KEYDOWN:
+                if (event.key.keysym.scancode == SDL_SCANCODE_ESCAPE)
+                {
+                    isRunning = false;
+                }
+
+                athleteScoreboard.HandleKeyPress(event.key.keysym.scancode);
+
+                break;
+
+            case SDL_WINDOWEVENT:
+                if (event.window.event == SDL_WINDOWEVENT_EXPOSED || event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED || event.window.event == SDL_WINDOWEVENT_RESTORED)
+                {
+                    athleteScoreboard.MarkDirty();
+                }
+
+                break;
+
+            case SDL_QUIT:
+                isRunning = false;
+
+                break;
+            }
+        };
+
+        const std::float_t exportDeltaTime = 1.0f / static_cast<std::float_t>(options.exportFrameRate);
+        std::uint32_t heldFrameCount = 0u;
+
         SDL_Event event{ };
 
         while (isRunning)
         {
+            if (const auto timeUntilNextUpdate = athleteScoreboard.GetTimeUntilNextUpdate();
+                !options.isHeadless && timeUntilNextUpdate != std::chrono::milliseconds::zero())
+            {
+                const bool didReceiveEvent = timeUntilNextUpdate.has_value()
+                    ? SDL_WaitEventTimeout(&event, static_cast<std::int32_t>(timeUntilNextUpdate->count())) == 1
+                    : SDL_WaitEvent(&event) == 1;
+
+                if (didReceiveEvent)
+                {
+                    handleEvent(event);
+                }
+
+                tickCount = std::chrono::steady_clock::now();
+                framePacer->Reset();
+            }
+
             const auto newTickCount = std::chrono::steady_clock::now();
             const auto frameTicks = newTickCount - tickCount;
             tickCount = newTickCount;
 
-            const std::float_t deltaTime = static_cast<std::float_t>(frameTicks.count()) /
-                static_cast<std::float_t>(std::chrono::steady_clock::period::den);
+            const std::float_t deltaTime = frameExporter.has_value()
+                ? exportDeltaTime
+                : static_cast<std::float_t>(frameTicks.count()) / static_cast<std::float_t>(std::chrono::steady_clock::period::den);
 
             athleteScoreboard.Update(deltaTime);
-            athleteScoreboard.Render(renderer);
 
-            renderer.Present();
+            const bool isRenderingFrame = athleteScoreboard.NeedsRender();
 
-            while (SDL_PollEvent(&event) == 1)
+            if (isRenderingFrame)
             {
-                switch (event.type)
-                {
-                case SDL_KEYDOWN:
-                    if (event.key.keysym.scancode == SDL_SCANCODE_ESCAPE)
-                    {
-                        isRunning = false;
-                    }
+                athleteScoreboard.Render(renderer);
+            }
 
-                    athleteScoreboard.HandleKeyPress(event.key.keysym.scancode);
+            if (frameExporter.has_value())
+            {
+                frameExporter->Submit(renderer.ReadPixels());
+            }
 
-                    break;
+            if (isRenderingFrame)
+            {
+                renderer.Present();
+            }
 
-                case SDL_QUIT:
-                    isRunning = false;
+            while (SDL_PollEvent(&event) == 1)
+            {
+                handleEvent(event);
+            }
 
-                    break;
-                }
+            if (framePacer.has_value())
+            {
+                framePacer->WaitForNextFrame(isRenderingFrame);
+            }
+
+            if (!options.isHeadless)
+            {
+                continue;
+            }
+
+            if (const bool hasFinished = athleteScoreboard.HasFinished() && !athleteScoreboard.NeedsRender();
+                (hasFinished || athleteScoreboard.CanAdvanceState()) && heldFrameCount < stageHoldFrameCount)
+            {
+                ++heldFrameCount;
+            }
+            else if (hasFinished)
+            {
+                isRunning = false;
             }
+            else if (athleteScoreboard.CanAdvanceState())
+            {
+                athleteScoreboard.AdvanceState();
+                heldFrameCount = 0u;
+            }
+        }
+
+        if (frameExporter.has_value())
+        {
+            frameExporter->Finish();
+            spdlog::info("Exported {} frames.", frameExporter->GetSubmittedFrameCount());
         }
+
+        athleteScoreboard.ReleaseTextCaches();
     }
 
     TTF_Quit();
@@ -0,0 +1,144 @@
+#include "MappedFile.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string& filepath)
+{
+#ifdef _WIN32
+    m_fileHandle = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (m_fileHandle == INVALID_HANDLE_VALUE)
+    {
+        m_fileHandle = nullptr;
+
+        return;
+    }
+
+    LARGE_INTEGER fileSize{ };
+
+    if (GetFileSizeEx(m_fileHandle, &fileSize) == FALSE || fileSize.QuadPart == 0)
+    {
+        Close();
+
+        return;
+    }
+
+    m_mappingHandle = CreateFileMappingA(m_fileHandle, nullptr, PAGE_READONLY, 0u, 0u, nullptr);
+
+    if (m_mappingHandle == nullptr)
+    {
+        Close();
+
+        return;
+    }
+
+    m_data = static_cast<const std::byte*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0u, 0u, 0u));
+    m_size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    m_fileDescriptor = open(filepath.c_str(), O_RDONLY);
+
+    if (m_fileDescriptor == -1)
+    {
+        return;
+    }
+
+    struct stat fileStatus{ };
+
+    if (fstat(m_fileDescriptor, &fileStatus) != 0 || fileStatus.st_size == 0)
+    {
+        Close();
+
+        return;
+    }
+
+    void* const mappedData = mmap(nullptr, static_cast<std::size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, m_fileDescriptor, 0);
+
+    if (mappedData != MAP_FAILED)
+    {
+        m_data = static_cast<const std::byte*>(mappedData);
+        m_size = static_cast<std::size_t>(fileStatus.st_size);
+    }
+#endif
+
+    if (m_data == nullptr)
+    {
+        Close();
+    }
+}
+
+MappedFile::~MappedFile() noexcept
+{
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+auto MappedFile::operator =(MappedFile&& other) noexcept -> MappedFile&
+{
+    if (this != &other)
+    {
+        Close();
+
+#ifdef _WIN32
+        m_fileHandle = std::exchange(other.m_fileHandle, nullptr);
+        m_mappingHandle = std::exchange(other.m_mappingHandle, nullptr);
+#else
+        m_fileDescriptor = std::exchange(other.m_fileDescriptor, -1);
+#endif
+
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0u);
+    }
+
+    return *this;
+}
+
+auto MappedFile::Close() noexcept -> void
+{
+#ifdef _WIN32
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+    }
+
+    if (m_mappingHandle != nullptr)
+    {
+        CloseHandle(m_mappingHandle);
+        m_mappingHandle = nullptr;
+    }
+
+    if (m_fileHandle != nullptr)
+    {
+        CloseHandle(m_fileHandle);
+        m_fileHandle = nullptr;
+    }
+#else
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<std::byte*>(m_data), m_size);
+    }
+
+    if (m_fileDescriptor != -1)
+    {
+        close(m_fileDescriptor);
+        m_fileDescriptor = -1;
+    }
+#endif
+
+    m_data = nullptr;
+    m_size = 0u;
+}
@@ -1,5 +1,23 @@
 #include "Renderer.h"
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+
+namespace
+{
+    constexpr SDL_Colour White{ 0xFFu, 0xFFu, 0xFFu, SDL_ALPHA_OPAQUE };
+
+    constexpr std::int32_t VerticesPerQuad = 4;
+    constexpr std::int32_t IndicesPerQuad = 6;
+
+    [[nodiscard]] constexpr auto AreColoursEqual(const SDL_Colour& lhs, const SDL_Colour& rhs) noexcept -> bool
+    {
+        return lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b && lhs.a == rhs.a;
+    }
+}
+
 Renderer::Renderer(const Window& window)
 {
     m_handle = SDL_CreateRenderer(
@@ -7,42 +25,253 @@ Renderer::Renderer(const Window& window)
         -1,
         SDL_RENDERER_ACCELERATED
     );
+
+    if (m_handle == nullptr)
+    {
+        return;
+    }
+
+    const Window::Size windowSize = window.GetSize();
+    const Window::Size outputSize = GetOutputSize();
+
+    if (windowSize.height > 0u && outputSize.height != windowSize.height)
+    {
+        m_pixelDensity = static_cast<std::float_t>(outputSize.height) / static_cast<std::float_t>(windowSize.height);
+        SDL_RenderSetScale(m_handle, m_pixelDensity, m_pixelDensity);
+    }
+}
+
+Renderer::Renderer(const Window::Size size)
+{
+    m_surface = SDL_CreateRGBSurfaceWithFormat(0u, static_cast<std::int32_t>(size.width), static_cast<std::int32_t>(size.height), 32, SDL_PIXELFORMAT_ARGB8888);
+
+    if (m_surface != nullptr)
+    {
+        m_handle = SDL_CreateSoftwareRenderer(m_surface);
+    }
 }
 
 Renderer::~Renderer() noexcept
 {
-    SDL_DestroyRenderer(m_handle);
+    DestroyPendingTextures();
+
+    if (m_handle != nullptr)
+    {
+        SDL_DestroyRenderer(m_handle);
+    }
+
+    if (m_surface != nullptr)
+    {
+        SDL_FreeSurface(m_surface);
+    }
 }
 
 auto Renderer::Clear(const SDL_Colour& colour) const -> void
 {
-    SDL_SetRenderDrawColor(m_handle, colour.r, colour.g, colour.b, colour.a);
+    SetDrawColour(colour);
     SDL_RenderClear(m_handle);
 }
 
-auto Renderer::DrawRectangle(const SDL_Rect& rectangle, const SDL_Colour& colour) const -> void
+auto Renderer::DrawRectangle(const SDL_Rect& rectangle, const SDL_Colour& colour, const Layer layer) const -> void
 {
-    SDL_SetRenderDrawColor(m_handle, colour.r, colour.g, colour.b, colour.a);
-    SDL_RenderFillRect(m_handle, &rectangle);
+    RecordQuad(nullptr, rectangle, SDL_FRect{ .x = 0.0f, .y = 0.0f, .w = 0.0f, .h = 0.0f }, colour, layer);
 }
 
-auto Renderer::DrawTexture(SDL_Texture* const texture, const SDL_Rect& area, const std::optional<SDL_Colour>& colourMod) const -> void
+auto Renderer::DrawTexture(SDL_Texture* const texture, const SDL_Rect& area, const Layer layer, const std::optional<SDL_Colour>& colourMod) const -> void
 {
-    if (colourMod.has_value())
+    RecordQuad(texture, area, SDL_FRect{ .x = 0.0f, .y = 0.0f, .w = 1.0f, .h = 1.0f }, colourMod.value_or(White), layer);
+}
+
+auto Renderer::DrawTexture(SDL_Texture* const texture, const SDL_Rect& sourceArea, const SDL_Rect& area, const Layer layer, const std::optional<SDL_Colour>& colourMod) const -> void
+{
+    std::int32_t textureWidth = 0;
+    std::int32_t textureHeight = 0;
+    SDL_QueryTexture(texture, nullptr, nullptr, &textureWidth, &textureHeight);
+
+    const std::float_t inverseTextureWidth = 1.0f / static_cast<std::float_t>(std::max(textureWidth, 1));
+    const std::float_t inverseTextureHeight = 1.0f / static_cast<std::float_t>(std::max(textureHeight, 1));
+
+    RecordQuad(
+        texture,
+        area,
+        SDL_FRect{
+            .x = static_cast<std::float_t>(sourceArea.x) * inverseTextureWidth,
+            .y = static_cast<std::float_t>(sourceArea.y) * inverseTextureHeight,
+            .w = static_cast<std::float_t>(sourceArea.w) * inverseTextureWidth,
+            .h = static_cast<std::float_t>(sourceArea.h) * inverseTextureHeight,
+        },
+        colourMod.value_or(White),
+        layer
+    );
+}
+
+auto Renderer::DestroyTexture(SDL_Texture* const texture) const -> void
+{
+    m_texturesPendingDestruction.push_back(texture);
+}
+
+auto Renderer::Flush() const -> void
+{
+    std::stable_sort(
+        std::begin(m_commands), std::end(m_commands),
+        [](const DrawCommand& lhs, const DrawCommand& rhs) -> bool
+        {
+            if (lhs.group != rhs.group)
+            {
+                return lhs.group < rhs.group;
+            }
+
+            if (lhs.layer != rhs.layer)
+            {
+                return lhs.layer < rhs.layer;
+            }
+
+            return std::less<SDL_Texture*>()(lhs.texture, rhs.texture);
+        }
+    );
+
+    m_sortedVertices.clear();
+
+    for (const auto& command : m_commands)
     {
-        SDL_SetTextureColorMod(texture, colourMod.value().r, colourMod.value().g, colourMod.value().b);
-        SDL_SetTextureAlphaMod(texture, colourMod.value().a);
+        const auto firstVertex = std::next(std::cbegin(m_vertices), command.firstVertex);
+        m_sortedVertices.insert(std::end(m_sortedVertices), firstVertex, std::next(firstVertex, VerticesPerQuad));
     }
-    else
+
+    for (auto quadVertex = static_cast<std::int32_t>(m_indices.size() / static_cast<std::size_t>(IndicesPerQuad)) * VerticesPerQuad;
+        m_indices.size() < m_commands.size() * static_cast<std::size_t>(IndicesPerQuad);
+        quadVertex += VerticesPerQuad)
+    {
+        m_indices.insert(
+            std::end(m_indices),
+            {
+                quadVertex, quadVertex + 1, quadVertex + 2,
+                quadVertex + 1, quadVertex + 3, quadVertex + 2,
+            }
+        );
+    }
+
+    auto commandRun = std::cbegin(m_commands);
+
+    while (commandRun != std::cend(m_commands))
     {
-        SDL_SetTextureColorMod(texture, 0xFFu, 0xFFu, 0xFFu);
-        SDL_SetTextureAlphaMod(texture, SDL_ALPHA_OPAQUE);
+        const auto commandRunEnd = std::find_if(
+            commandRun, std::cend(m_commands),
+            [commandRun](const DrawCommand& command) -> bool
+            {
+                return command.group != commandRun->group || command.layer != commandRun->layer || command.texture != commandRun->texture;
+            }
+        );
+
+        const auto firstQuad = static_cast<std::int32_t>(std::distance(std::cbegin(m_commands), commandRun));
+        const auto quadCount = static_cast<std::int32_t>(std::distance(commandRun, commandRunEnd));
+
+        if (commandRun->texture != nullptr)
+        {
+            SetTextureModulation(commandRun->texture, White);
+        }
+
+        SDL_RenderGeometry(
+            m_handle, commandRun->texture,
+            m_sortedVertices.data() + firstQuad * VerticesPerQuad, quadCount * VerticesPerQuad,
+            m_indices.data(), quadCount * IndicesPerQuad
+        );
+
+        commandRun = commandRunEnd;
     }
 
-    SDL_RenderCopy(m_handle, texture, nullptr, &area);
+    m_vertices.clear();
+    m_commands.clear();
 }
 
 auto Renderer::Present() const -> void
 {
+    Flush();
     SDL_RenderPresent(m_handle);
+
+    DestroyPendingTextures();
+}
+
+[[nodiscard]] auto Renderer::ReadPixels() const -> std::vector<std::uint8_t>
+{
+    Flush();
+
+    const Window::Size outputSize = GetOutputSize();
+    std::vector<std::uint8_t> rgbaPixels(static_cast<std::size_t>(outputSize.width) * outputSize.height * 4u);
+
+    SDL_RenderReadPixels(m_handle, nullptr, SDL_PIXELFORMAT_RGBA32, rgbaPixels.data(), static_cast<std::int32_t>(outputSize.width * 4u));
+
+    return rgbaPixels;
+}
+
+[[nodiscard]] auto Renderer::GetOutputSize() const -> Window::Size
+{
+    std::int32_t width = 0;
+    std::int32_t height = 0;
+    SDL_GetRendererOutputSize(m_handle, &width, &height);
+
+    return Window::Size{
+        .width = static_cast<std::uint32_t>(width),
+        .height = static_cast<std::uint32_t>(height),
+    };
+}
+
+auto Renderer::RecordQuad(SDL_Texture* const texture, const SDL_Rect& area, const SDL_FRect& textureArea, const SDL_Colour& colour, const Layer layer) const -> void
+{
+    m_commands.push_back(
+        DrawCommand{
+            .group = m_drawGroup,
+            .layer = layer,
+            .texture = texture,
+            .firstVertex = static_cast<std::uint32_t>(m_vertices.size()),
+        }
+    );
+
+    const std::float_t left = static_cast<std::float_t>(area.x);
+    const std::float_t top = static_cast<std::float_t>(area.y);
+    const std::float_t right = static_cast<std::float_t>(area.x + area.w);
+    const std::float_t bottom = static_cast<std::float_t>(area.y + area.h);
+
+    const std::float_t textureRight = textureArea.x + textureArea.w;
+    const std::float_t textureBottom = textureArea.y + textureArea.h;
+
+    m_vertices.push_back(SDL_Vertex{ .position = SDL_FPoint{ .x = left, .y = top }, .color = colour, .tex_coord = SDL_FPoint{ .x = textureArea.x, .y = textureArea.y } });
+    m_vertices.push_back(SDL_Vertex{ .position = SDL_FPoint{ .x = right, .y = top }, .color = colour, .tex_coord = SDL_FPoint{ .x = textureRight, .y = textureArea.y } });
+    m_vertices.push_back(SDL_Vertex{ .position = SDL_FPoint{ .x = left, .y = bottom }, .color = colour, .tex_coord = SDL_FPoint{ .x = textureArea.x, .y = textureBottom } });
+    m_vertices.push_back(SDL_Vertex{ .position = SDL_FPoint{ .x = right, .y = bottom }, .color = colour, .tex_coord = SDL_FPoint{ .x = textureRight, .y = textureBottom } });
+}
+
+auto Renderer::SetDrawColour(const SDL_Colour& colour) const -> void
+{
+    if (m_drawColour.has_value() && AreColoursEqual(m_drawColour.value(), colour))
+    {
+        return;
+    }
+
+    SDL_SetRenderDrawColor(m_handle, colour.r, colour.g, colour.b, colour.a);
+    m_drawColour = colour;
+}
+
+auto Renderer::SetTextureModulation(SDL_Texture* const texture, const SDL_Colour& colour) const -> void
+{
+    if (const auto textureModulation = m_textureModulations.find(texture);
+        textureModulation != std::end(m_textureModulations) && AreColoursEqual(textureModulation->second, colour))
+    {
+        return;
+    }
+
+    SDL_SetTextureColorMod(texture, colour.r, colour.g, colour.b);
+    SDL_SetTextureAlphaMod(texture, colour.a);
+    m_textureModulations[texture] = colour;
+}
+
+auto Renderer::DestroyPendingTextures() const -> void
+{
+    for (const auto texture : m_texturesPendingDestruction)
+    {
+        m_textureModulations.erase(texture);
+        SDL_DestroyTexture(texture);
+    }
+
+    m_texturesPendingDestruction.clear();
 }
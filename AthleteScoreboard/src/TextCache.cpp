@@ -1,60 +1,360 @@
 #include "TextCache.h"
 
+#include <cmath>
+#include <format>
+#include <utility>
+
 #include <spdlog/spdlog.h>
 
-TextCache::TextCache(TTF_Font* const font, const Renderer& renderer)
-    : m_font(font), m_renderer(&renderer)
-{ }
+namespace
+{
+    constexpr TTF_Direction TextDirection = TTF_DIRECTION_LTR;
+    constexpr std::string_view TextScriptName = "Latn";
+}
+
+TextCache::TextCache(TTF_Font* const font, const Renderer& renderer, const Backend backend)
+{
+    Initialise(font, renderer, backend);
+}
 
 TextCache::~TextCache() noexcept
 {
-    for (const auto& [name, texture] : m_textureLookup)
+    m_rasteriser.Stop();
+
+    for (const auto& [handle, surface] : m_rasterisedTexts)
     {
-        SDL_DestroyTexture(texture);
+        SDL_FreeSurface(surface);
     }
 
-    m_textureLookup.clear();
+    m_rasterisedTexts.clear();
 }
 
-auto TextCache::Initialise(TTF_Font* const font, const Renderer& renderer) -> void
+auto TextCache::Initialise(TTF_Font* const font, const Renderer& renderer, const Backend backend, const std::string& atlasCacheFilepath) -> void
 {
     m_font = font;
-    TTF_SetFontDirection(m_font, TTF_DIRECTION_LTR);
-    TTF_SetFontScriptName(m_font, "Latn");
+    TTF_SetFontDirection(m_font, TextDirection);
+    TTF_SetFontScriptName(m_font, TextScriptName.data());
 
     m_renderer = &renderer;
+    m_backend = backend;
+
+    m_glyphAtlas.Initialise(m_font, renderer, m_backend == Backend::SignedDistanceFieldAtlas ? GlyphAtlas::Mode::SignedDistanceField : GlyphAtlas::Mode::Bitmap, atlasCacheFilepath);
 }
 
-[[nodiscard]] auto TextCache::Get(const std::string& text) -> SDL_Texture*
+auto TextCache::Release() -> void
 {
-    if (!m_textureLookup.contains(text))
+    m_rasteriser.Stop();
+
+    for (const auto& [handle, surface] : m_rasterisedTexts)
     {
-        SDL_Surface* textSurface = TTF_RenderText_Blended(m_font, text.c_str(), SDL_Colour{ 0xFFu, 0xFFu, 0xFFu, SDL_ALPHA_OPAQUE });
+        SDL_FreeSurface(surface);
+    }
 
-        if (textSurface == nullptr)
-        {
-            spdlog::error("Failed to create pixel surface for text \"{}\".", text);
+    m_rasterisedTexts.clear();
+    m_pendingTextCount = 0u;
 
-            return nullptr;
+    for (auto& internedText : m_internedTexts)
+    {
+        if (internedText.texture != nullptr && m_renderer != nullptr)
+        {
+            m_renderer->DestroyTexture(internedText.texture);
         }
 
-        if (const auto textTexture = SDL_CreateTextureFromSurface(m_renderer->GetRawHandle(), textSurface);
-            textTexture != nullptr)
+        internedText.texture = nullptr;
+        internedText.byteCount = 0u;
+        internedText.isPending = false;
+    }
+
+    m_recentlyUsedTexts.clear();
+    m_statistics.bytesResident = 0u;
+
+    m_glyphAtlas.Release();
+    m_renderer = nullptr;
+}
+
+[[nodiscard]] auto TextCache::GetAtlasCacheFilepath(const std::string& cacheDirectory, const std::span<const std::byte> fontData, const std::int32_t pointSize, const Backend backend) -> std::string
+{
+    if (fontData.empty())
+    {
+        return "";
+    }
+
+    const TTF_Direction direction = TextDirection;
+    const bool isDistanceField = backend == Backend::SignedDistanceFieldAtlas;
+
+    std::uint64_t cacheKey = HashBytes(fontData);
+    cacheKey = HashBytes(std::as_bytes(std::span(&pointSize, 1u)), cacheKey);
+    cacheKey = HashBytes(std::as_bytes(std::span(&direction, 1u)), cacheKey);
+    cacheKey = HashBytes(std::as_bytes(std::span(TextScriptName)), cacheKey);
+    cacheKey = HashBytes(std::as_bytes(std::span(&isDistanceField, 1u)), cacheKey);
+
+    return std::format("{}{:016x}.atlas", cacheDirectory, cacheKey);
+}
+
+[[nodiscard]] auto TextCache::Intern(const std::string& text) -> TextHandle
+{
+    if (const auto existingHandle = m_handleLookup.find(text);
+        existingHandle != std::end(m_handleLookup))
+    {
+        return existingHandle->second;
+    }
+
+    const auto handle = static_cast<TextHandle>(m_internedTexts.size());
+    InternedText internedText{
+        .text = text,
+    };
+
+    if (m_backend != Backend::StringTextures)
+    {
+        internedText.size = TextureSize{
+            .width = static_cast<std::uint32_t>(m_glyphAtlas.MeasureText(text)),
+            .height = static_cast<std::uint32_t>(m_glyphAtlas.GetLineHeight()),
+        };
+    }
+    else
+    {
+        std::int32_t width = 0;
+        std::int32_t height = 0;
+        TTF_SizeText(m_font, text.c_str(), &width, &height);
+
+        internedText.size = TextureSize{
+            .width = static_cast<std::uint32_t>(width),
+            .height = static_cast<std::uint32_t>(height),
+        };
+    }
+
+    internedText.scaledWidth = GetScaledTextureWidth(internedText.size, m_targetHeight);
+
+    m_internedTexts.push_back(std::move(internedText));
+    m_handleLookup.try_emplace(text, handle);
+
+    return handle;
+}
+
+[[nodiscard]] auto TextCache::Get(const TextHandle handle) -> SDL_Texture*
+{
+    InternedText& internedText = m_internedTexts[handle];
+
+    if (internedText.texture != nullptr)
+    {
+        ++m_statistics.hits;
+        m_recentlyUsedTexts.splice(std::begin(m_recentlyUsedTexts), m_recentlyUsedTexts, internedText.recency);
+
+        return internedText.texture;
+    }
+
+    if (internedText.isPending)
+    {
+        return nullptr;
+    }
+
+    ++m_statistics.misses;
+
+    if (m_rasteriser.IsRunning())
+    {
+        internedText.isPending = true;
+        ++m_pendingTextCount;
+        m_rasteriser.Enqueue(handle, internedText.text);
+
+        return nullptr;
+    }
+
+    return AddTexture(handle, TTF_RenderText_Blended(m_font, internedText.text.c_str(), SDL_Colour{ 0xFFu, 0xFFu, 0xFFu, SDL_ALPHA_OPAQUE }));
+}
+
+auto TextCache::StartRasteriser(FontRegistry& fontRegistry, const std::string& fontPath, const std::int32_t pointSize, const std::uint32_t workerCount) -> void
+{
+    if (m_backend == Backend::StringTextures && workerCount > 0u)
+    {
+        m_rasteriser.Start(fontRegistry, fontPath, pointSize, workerCount);
+    }
+}
+
+auto TextCache::ProcessPendingUploads(const std::chrono::steady_clock::time_point deadline) -> void
+{
+    if (!m_rasteriser.IsRunning())
+    {
+        return;
+    }
+
+    for (auto& rasterisedText : m_rasteriser.TakeResults())
+    {
+        m_rasterisedTexts.push_back(std::move(rasterisedText));
+    }
+
+    for (bool isFirstUpload = true;
+        !m_rasterisedTexts.empty() && (isFirstUpload || std::chrono::steady_clock::now() < deadline);
+        isFirstUpload = false)
+    {
+        const auto [handle, surface] = m_rasterisedTexts.front();
+        m_rasterisedTexts.pop_front();
+
+        m_internedTexts[handle].isPending = false;
+        --m_pendingTextCount;
+
+        [[maybe_unused]] const auto texture = AddTexture(handle, surface);
+    }
+}
+
+auto TextCache::Prewarm(const std::vector<TextHandle>& handles) -> void
+{
+    m_glyphAtlas.UploadDirtyPages();
+    m_glyphAtlas.SaveCache();
+
+    if (m_memoryBudget != 0u && m_glyphAtlas.GetResidentByteCount() > m_memoryBudget)
+    {
+        spdlog::warn("The glyph atlas uses {} bytes, more than the text cache memory budget of {} bytes.", m_glyphAtlas.GetResidentByteCount(), m_memoryBudget);
+    }
+
+    if (m_backend != Backend::StringTextures)
+    {
+        return;
+    }
+
+    const std::uint64_t previousEvictionCount = m_statistics.evictions;
+
+    for (const auto handle : handles)
+    {
+        [[maybe_unused]] const auto texture = Get(handle);
+    }
+
+    ProcessPendingUploads(std::chrono::steady_clock::time_point::max());
+
+    while (m_pendingTextCount > 0u)
+    {
+        for (const auto& [handle, surface] : m_rasteriser.WaitForResults())
         {
-            m_textureLookup.try_emplace(text, textTexture);
+            m_internedTexts[handle].isPending = false;
+            --m_pendingTextCount;
+
+            [[maybe_unused]] const auto texture = AddTexture(handle, surface);
         }
-        else
+    }
+
+    if (m_statistics.evictions != previousEvictionCount)
+    {
+        spdlog::warn("Prewarming the text cache exceeded its memory budget; {} textures were evicted.", m_statistics.evictions - previousEvictionCount);
+    }
+}
+
+[[nodiscard]] auto TextCache::GetStatistics() const -> Statistics
+{
+    Statistics statistics = m_statistics;
+    statistics.glyphHits = m_glyphAtlas.GetGlyphHitCount();
+    statistics.glyphMisses = m_glyphAtlas.GetGlyphMissCount();
+    statistics.bytesResident = GetResidentByteCount();
+
+    return statistics;
+}
+
+auto TextCache::SetMemoryBudget(const std::size_t byteCount) -> void
+{
+    m_memoryBudget = byteCount;
+    EvictColdTextures();
+}
+
+auto TextCache::SetTargetHeight(const std::uint32_t targetHeight, const std::float_t pixelDensity) -> void
+{
+    m_targetHeight = targetHeight;
+    m_glyphAtlas.SetTargetHeight(static_cast<std::uint32_t>(std::lround(static_cast<std::float_t>(m_targetHeight) * pixelDensity)));
+
+    for (auto& internedText : m_internedTexts)
+    {
+        internedText.scaledWidth = GetScaledTextureWidth(internedText.size, m_targetHeight);
+    }
+}
+
+auto TextCache::Draw(const TextHandle handle, const SDL_Rect& area, const SDL_Colour& colour) -> void
+{
+    if (m_backend == Backend::StringTextures)
+    {
+        if (const auto texture = Get(handle);
+            texture != nullptr)
         {
-            spdlog::error("Failed to create texture for text \"{}\".", text);
+            m_renderer->DrawTexture(texture, area, Renderer::Layer::Text, colour);
 
-            return nullptr;
+            return;
         }
+    }
+
+    m_glyphAtlas.DrawText(m_internedTexts[handle].text, area, colour);
+}
+
+[[nodiscard]] auto TextCache::GetNumberSize(const std::uint32_t number, const std::string_view suffix) -> TextureSize
+{
+    const NumberText numberText = FormatNumber(number, suffix);
+
+    return TextureSize{
+        .width = static_cast<std::uint32_t>(m_glyphAtlas.MeasureText(numberText.GetView())),
+        .height = static_cast<std::uint32_t>(m_glyphAtlas.GetLineHeight()),
+    };
+}
+
+[[nodiscard]] auto TextCache::GetScaledNumberWidth(const std::uint32_t number, const std::string_view suffix) -> std::int32_t
+{
+    return GetScaledTextureWidth(GetNumberSize(number, suffix), m_targetHeight);
+}
+
+auto TextCache::DrawNumber(const std::uint32_t number, const SDL_Rect& area, const SDL_Colour& colour, const std::string_view suffix) -> void
+{
+    const NumberText numberText = FormatNumber(number, suffix);
+
+    m_glyphAtlas.DrawText(numberText.GetView(), area, colour);
+}
+
+[[nodiscard]] auto TextCache::AddTexture(const TextHandle handle, SDL_Surface* textSurface) -> SDL_Texture*
+{
+    InternedText& internedText = m_internedTexts[handle];
+
+    if (textSurface == nullptr)
+    {
+        spdlog::error("Failed to create pixel surface for text \"{}\".", internedText.text);
 
-        SDL_FreeSurface(textSurface);
-        textSurface = nullptr;
+        return nullptr;
     }
 
-    const auto texture = m_textureLookup.at(text);
+    const auto textTexture = SDL_CreateTextureFromSurface(m_renderer->GetRawHandle(), textSurface);
+    const std::size_t textureByteCount = static_cast<std::size_t>(textSurface->w) * static_cast<std::size_t>(textSurface->h) * sizeof(std::uint32_t);
 
-    return texture;
+    SDL_FreeSurface(textSurface);
+    textSurface = nullptr;
+
+    if (textTexture == nullptr)
+    {
+        spdlog::error("Failed to create texture for text \"{}\".", internedText.text);
+
+        return nullptr;
+    }
+
+    m_recentlyUsedTexts.push_front(handle);
+
+    internedText.texture = textTexture;
+    internedText.byteCount = textureByteCount;
+    internedText.recency = std::begin(m_recentlyUsedTexts);
+
+    m_statistics.bytesResident += textureByteCount;
+    EvictColdTextures();
+
+    return textTexture;
+}
+
+auto TextCache::EvictColdTextures() -> void
+{
+    if (m_memoryBudget == 0u)
+    {
+        return;
+    }
+
+    while (GetResidentByteCount() > m_memoryBudget && m_recentlyUsedTexts.size() > 1u)
+    {
+        InternedText& coldText = m_internedTexts[m_recentlyUsedTexts.back()];
+
+        m_renderer->DestroyTexture(coldText.texture);
+        m_statistics.bytesResident -= coldText.byteCount;
+        ++m_statistics.evictions;
+
+        coldText.texture = nullptr;
+        coldText.byteCount = 0u;
+        m_recentlyUsedTexts.pop_back();
+    }
 }
@@ -0,0 +1,143 @@
+#include "TextRasteriser.h"
+
+#include <utility>
+
+TextRasteriser::~TextRasteriser() noexcept
+{
+    Stop();
+}
+
+auto TextRasteriser::Start(FontRegistry& fontRegistry, const std::string& fontPath, const std::int32_t pointSize, const std::uint32_t workerCount) -> void
+{
+    Stop();
+
+    m_fontRegistry = &fontRegistry;
+
+    // FreeType faces must be created and destroyed on the same thread.
+    for (std::uint32_t i = 0u; i < workerCount; ++i)
+    {
+        TTF_Font* workerFont = nullptr;
+
+        try
+        {
+            workerFont = m_fontRegistry->AcquireUnique(fontPath, pointSize);
+        }
+        catch (...)
+        {
+            Stop();
+
+            throw;
+        }
+
+        TTF_SetFontDirection(workerFont, TTF_DIRECTION_LTR);
+        TTF_SetFontScriptName(workerFont, "Latn");
+
+        m_workerFonts.push_back(workerFont);
+    }
+
+    for (const auto workerFont : m_workerFonts)
+    {
+        m_workers.emplace_back(
+            [this, workerFont](const std::stop_token stopToken) -> void
+            {
+                RunWorker(stopToken, workerFont);
+            }
+        );
+    }
+}
+
+auto TextRasteriser::Stop() -> void
+{
+    for (auto& worker : m_workers)
+    {
+        worker.request_stop();
+    }
+
+    m_requestCondition.notify_all();
+    m_workers.clear();
+
+    for (const auto workerFont : m_workerFonts)
+    {
+        m_fontRegistry->Release(workerFont);
+    }
+
+    m_workerFonts.clear();
+    m_requests.clear();
+
+    for (const auto& [id, surface] : m_results)
+    {
+        SDL_FreeSurface(surface);
+    }
+
+    m_results.clear();
+}
+
+auto TextRasteriser::Enqueue(const std::uint32_t id, std::string text) -> void
+{
+    {
+        const std::scoped_lock requestLock(m_requestMutex);
+        m_requests.push_back(Request{ .id = id, .text = std::move(text) });
+    }
+
+    m_requestCondition.notify_one();
+}
+
+[[nodiscard]] auto TextRasteriser::TakeResults() -> std::vector<RasterisedText>
+{
+    std::vector<RasterisedText> results{ };
+
+    {
+        const std::scoped_lock resultLock(m_resultMutex);
+        results.swap(m_results);
+    }
+
+    return results;
+}
+
+[[nodiscard]] auto TextRasteriser::WaitForResults() -> std::vector<RasterisedText>
+{
+    std::vector<RasterisedText> results{ };
+
+    {
+        std::unique_lock resultLock(m_resultMutex);
+        m_resultCondition.wait(resultLock, [this]() -> bool { return !m_results.empty(); });
+
+        results.swap(m_results);
+    }
+
+    return results;
+}
+
+auto TextRasteriser::RunWorker(const std::stop_token stopToken, TTF_Font* const font) -> void
+{
+    while (!stopToken.stop_requested())
+    {
+        Request request{ };
+
+        {
+            std::unique_lock requestLock(m_requestMutex);
+
+            if (!m_requestCondition.wait(requestLock, stopToken, [this]() -> bool { return !m_requests.empty(); }))
+            {
+                return;
+            }
+
+            request = std::move(m_requests.front());
+            m_requests.pop_front();
+        }
+
+        SDL_Surface* textSurface = TTF_RenderText_Blended(font, request.text.c_str(), SDL_Colour{ 0xFFu, 0xFFu, 0xFFu, SDL_ALPHA_OPAQUE });
+
+        {
+            const std::scoped_lock resultLock(m_resultMutex);
+            m_results.push_back(
+                RasterisedText{
+                    .id = request.id,
+                    .surface = textSurface,
+                }
+            );
+        }
+
+        m_resultCondition.notify_one();
+    }
+}
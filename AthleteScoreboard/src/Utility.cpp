@@ -1,5 +1,9 @@
 #include "Utility.h"
 
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+
 [[nodiscard]] auto GetTextureSize(SDL_Texture* const texture) -> TextureSize
 {
     std::int32_t width = 0;
@@ -12,38 +16,64 @@
     };
 }
 
-[[nodiscard]] auto GetOrdinalNumber(const std::uint32_t cardinalNumber) -> std::string
+[[nodiscard]] auto GetScaledTextureWidth(const TextureSize size, const std::uint32_t targetHeight) -> std::int32_t
+{
+    if (size.height == 0u)
+    {
+        return 0;
+    }
+
+    const std::float_t textureToTargetRatio = static_cast<std::float_t>(size.height) / static_cast<std::float_t>(targetHeight);
+
+    return static_cast<std::int32_t>(static_cast<std::float_t>(size.width) / textureToTargetRatio);
+}
+
+[[nodiscard]] auto FormatNumber(const std::uint32_t number, const std::string_view suffix) -> NumberText
 {
-    const std::string numberString = std::to_string(cardinalNumber);
-    const std::uint32_t remainder = cardinalNumber % 10u;
+    NumberText numberText{ };
+
+    const auto [end, error] = std::to_chars(numberText.characters.data(), numberText.characters.data() + numberText.characters.size(), number);
+    numberText.length = static_cast<std::size_t>(end - numberText.characters.data());
+
+    const std::size_t suffixLength = std::min(suffix.length(), numberText.characters.size() - numberText.length);
+    std::copy_n(suffix.data(), suffixLength, numberText.characters.data() + numberText.length);
+    numberText.length += suffixLength;
 
-    switch (remainder)
+    return numberText;
+}
+
+[[nodiscard]] auto GetOrdinalSuffix(const std::uint32_t cardinalNumber) -> std::string_view
+{
+    switch (cardinalNumber % 10u)
     {
     case 1u:
-        if (cardinalNumber % 100u == 11u)
-        {
-            return numberString + "th";
-        }
-
-        return numberString + "st";
+        return cardinalNumber % 100u == 11u ? "th" : "st";
 
     case 2u:
-        if (cardinalNumber % 100u == 12u)
-        {
-            return numberString + "th";
-        }
-
-        return numberString + "nd";
+        return cardinalNumber % 100u == 12u ? "th" : "nd";
 
     case 3u:
-        if (cardinalNumber % 100u == 13u)
-        {
-            return numberString + "th";
-        }
-
-        return numberString + "rd";
+        return cardinalNumber % 100u == 13u ? "th" : "rd";
 
     default:
-        return numberString + "th";
+        return "th";
+    }
+}
+
+[[nodiscard]] auto GetOrdinalNumber(const std::uint32_t cardinalNumber) -> std::string
+{
+    return std::to_string(cardinalNumber) + std::string(GetOrdinalSuffix(cardinalNumber));
+}
+
+[[nodiscard]] auto HashBytes(const std::span<const std::byte> bytes, const std::uint64_t seed) -> std::uint64_t
+{
+    std::uint64_t hash = seed;
+
+    for (const auto byte : bytes)
+    {
+        hash ^= static_cast<std::uint64_t>(byte);
+        hash *= 0x00000100000001B3u;
     }
+
+    return hash;
 }
@@ -8,7 +8,7 @@ Window::Window(const Size size, const std::string_view title)
         SDL_WINDOWPOS_CENTERED,
         static_cast<std::int32_t>(size.width),
         static_cast<std::int32_t>(size.height),
-        SDL_WINDOW_SHOWN
+        SDL_WINDOW_HIDDEN | SDL_WINDOW_ALLOW_HIGHDPI
     );
 }
 
@@ -17,6 +17,11 @@ Window::~Window() noexcept
     SDL_DestroyWindow(m_handle);
 }
 
+auto Window::Show() const -> void
+{
+    SDL_ShowWindow(m_handle);
+}
+
 [[nodiscard]] auto Window::GetSize() const -> Size
 {
     std::int32_t width = 0;
@@ -29,12 +29,28 @@ ELIMINATIONS = {
 FONTS = {
     athletes = "data/fonts/Manrope-Bold.ttf",
     eliminated = "data/fonts/Manrope-ExtraBold.ttf",
+    text_backend = "glyph_atlas",
+    sdf_point_size = 48,
+    text_cache_budget_megabytes = 64,
+    persistent_cache = true,
 }
 
+FRAME_PACING = {
+    mode = "vsync",
+    target_frame_rate = 60,
+}
+
+VIEWPORT = {
+    enabled = false,
+    visible_rows = 12,
+    follow_athlete = "",
+}
+
+-- Easings can name a built-in curve (linear, or in_/out_/in_out_ followed by quad, cubic, quart, expo, back, elastic or bounce),
+-- or be a function of x in [0, 1] such as: ordering = function(x) return 1.0 - ((1.0 - x) ^ 2.0) end
 EASINGS = {
-    ordering = function(x)
-        return 1.0 - ((1.0 - x) ^ 2.0)
-    end,
+    ordering = "out_quad",
+    scores = "linear",
 }
 
 ATHLETES = {